@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <neo/convolution.hpp>
+#include <neo/execution.hpp>
 
 #include <neo/testing/testing.hpp>
 
@@ -44,6 +45,33 @@ auto conv(benchmark::State& state) -> void
     state.SetBytesProcessed(items * sizeof(Real));
 }
 
+// 16 channels of 8 s at 48 kHz, args: block size & number of threads
+auto partition(benchmark::State& state) -> void
+{
+    auto const block_size   = static_cast<std::size_t>(state.range(0));
+    auto const num_threads  = static_cast<std::size_t>(state.range(1));
+    auto const num_channels = std::size_t(16);
+    auto const length       = std::size_t(8 * 48'000);
+
+    auto impulse = stdex::mdarray<float, stdex::dextents<std::size_t, 2>>{num_channels, length};
+    for (auto ch = std::size_t(0); ch < num_channels; ++ch) {
+        auto const noise = neo::generate_noise_signal<float>(length, std::random_device{}());
+        neo::copy(noise.to_mdspan(), stdex::submdspan(impulse.to_mdspan(), ch, stdex::full_extent));
+    }
+
+    auto pool = neo::thread_pool{num_threads};
+
+    for (auto _ : state) {
+        auto filter = neo::convolution::uniform_partition(impulse.to_mdspan(), block_size, pool);
+        benchmark::DoNotOptimize(filter.data());
+        benchmark::ClobberMemory();
+    }
+
+    auto const items = static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(impulse.size());
+    state.SetItemsProcessed(items);
+    state.SetBytesProcessed(items * static_cast<int64_t>(sizeof(float)));
+}
+
 constexpr auto const min_block  = 4096;
 constexpr auto const max_block  = 4096;
 constexpr auto const min_filter = 1 << 11;
@@ -63,4 +91,9 @@ BENCHMARK(conv<neo::convolution::split_upola_convolver<std::complex<float>>>)
 BENCHMARK(conv<neo::convolution::split_upols_convolver<std::complex<float>>>)
     ->ArgsProduct({benchmark::CreateRange(min_block, max_block, 2), benchmark::CreateRange(min_filter, max_filter, 2)});
 
+BENCHMARK(conv<neo::convolution::block_float_upols_convolver<std::complex<float>>>)
+    ->ArgsProduct({benchmark::CreateRange(min_block, max_block, 2), benchmark::CreateRange(min_filter, max_filter, 2)});
+
+BENCHMARK(partition)->ArgsProduct({{256, 4096}, {1, 2, 4, 8}})->Unit(benchmark::kMillisecond)->UseRealTime();
+
 BENCHMARK_MAIN();
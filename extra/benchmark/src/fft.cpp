@@ -1,11 +1,14 @@
 // SPDX-License-Identifier: MIT
 
+#include <neo/execution.hpp>
 #include <neo/fft.hpp>
 
 #include <neo/testing/testing.hpp>
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+
 namespace {
 
 template<typename Plan>
@@ -73,6 +76,36 @@ auto c2c_r4(benchmark::State& state) -> void
     state.SetBytesProcessed(items * sizeof(Complex));
 }
 
+template<typename Plan>
+auto c2c_threaded(benchmark::State& state) -> void
+{
+    using Complex = typename Plan::value_type;
+
+    auto const len   = static_cast<std::size_t>(state.range(0));
+    auto const order = neo::fft::next_order(len);
+    auto const noise = neo::generate_noise_signal<Complex>(len, std::random_device{}());
+
+    auto pool = neo::thread_pool{static_cast<std::size_t>(state.range(1))};
+    auto plan = Plan{neo::fft::from_order, order, pool};
+    auto work = noise;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        neo::copy(noise.to_mdspan(), work.to_mdspan());
+        state.ResumeTiming();
+
+        neo::fft::fft(plan, work.to_mdspan());
+
+        benchmark::DoNotOptimize(work.data());
+        benchmark::ClobberMemory();
+    }
+
+    auto const items       = static_cast<int64_t>(state.iterations()) * plan.size();
+    auto const flop        = 5UL * size_t(plan.order()) * items;
+    state.counters["flop"] = benchmark::Counter(static_cast<double>(flop), benchmark::Counter::kIsRate);
+    state.SetBytesProcessed(items * sizeof(Complex));
+}
+
 template<typename Plan>
 auto split_c2c(benchmark::State& state) -> void
 {
@@ -108,22 +141,134 @@ auto split_c2c(benchmark::State& state) -> void
     state.SetBytesProcessed(items * sizeof(Float) * 2);
 }
 
+// Second argument: number of rows, layout_right keeps each transform contiguous, layout_left each column
+template<typename Plan, typename Layout>
+auto c2c_batch(benchmark::State& state) -> void
+{
+    using Complex = typename Plan::value_type;
+
+    auto const len   = static_cast<std::size_t>(state.range(0));
+    auto const rows  = static_cast<std::size_t>(state.range(1));
+    auto const order = neo::fft::next_order(len);
+    auto const noise = neo::generate_noise_signal<Complex>(len * rows, std::random_device{}());
+
+    auto plan = Plan{neo::fft::from_order, order};
+    auto work = stdex::mdarray<Complex, stdex::dextents<std::size_t, 2>, Layout>{rows, len};
+    std::copy(noise.data(), noise.data() + noise.size(), work.data());
+
+    for (auto _ : state) {
+        neo::fft::fft(plan, work.to_mdspan());
+
+        benchmark::DoNotOptimize(work.data());
+        benchmark::ClobberMemory();
+    }
+
+    auto const items       = static_cast<int64_t>(state.iterations()) * plan.size() * rows;
+    auto const flop        = 5UL * size_t(plan.order()) * items;
+    state.counters["flop"] = benchmark::Counter(static_cast<double>(flop), benchmark::Counter::kIsRate);
+    state.SetBytesProcessed(items * sizeof(Complex));
+}
+
+// Same as c2c_batch<Plan, layout_right>, but one call per row
+template<typename Plan>
+auto c2c_rows(benchmark::State& state) -> void
+{
+    using Complex = typename Plan::value_type;
+
+    auto const len   = static_cast<std::size_t>(state.range(0));
+    auto const rows  = static_cast<std::size_t>(state.range(1));
+    auto const order = neo::fft::next_order(len);
+    auto const noise = neo::generate_noise_signal<Complex>(len * rows, std::random_device{}());
+
+    auto plan = Plan{neo::fft::from_order, order};
+    auto work = stdex::mdarray<Complex, stdex::dextents<std::size_t, 2>>{rows, len};
+    std::copy(noise.data(), noise.data() + noise.size(), work.data());
+
+    for (auto _ : state) {
+        for (auto row = std::size_t(0); row < rows; ++row) {
+            neo::fft::fft(plan, stdex::submdspan(work.to_mdspan(), row, stdex::full_extent));
+        }
+
+        benchmark::DoNotOptimize(work.data());
+        benchmark::ClobberMemory();
+    }
+
+    auto const items       = static_cast<int64_t>(state.iterations()) * plan.size() * rows;
+    auto const flop        = 5UL * size_t(plan.order()) * items;
+    state.counters["flop"] = benchmark::Counter(static_cast<double>(flop), benchmark::Counter::kIsRate);
+    state.SetBytesProcessed(items * sizeof(Complex));
+}
+
+template<typename Complex>
+auto reorder_plan(benchmark::State& state) -> void
+{
+    auto const len   = static_cast<std::size_t>(state.range(0));
+    auto const order = neo::fft::next_order(len);
+    auto const noise = neo::generate_noise_signal<Complex>(len, std::random_device{}());
+
+    auto plan = neo::fft::bitrevorder_plan{order};
+    auto work = noise;
+
+    for (auto _ : state) {
+        plan(work.to_mdspan());
+
+        benchmark::DoNotOptimize(work.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(len * sizeof(Complex)));
+}
+
+template<typename Complex>
+auto reorder_inline(benchmark::State& state) -> void
+{
+    auto const len   = static_cast<std::size_t>(state.range(0));
+    auto const noise = neo::generate_noise_signal<Complex>(len, std::random_device{}());
+
+    auto work = noise;
+
+    for (auto _ : state) {
+        neo::fft::bitrevorder(work.to_mdspan());
+
+        benchmark::DoNotOptimize(work.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(len * sizeof(Complex)));
+}
+
 }  // namespace
 
 using namespace neo::fft;
 namespace kernel = neo::fft::kernel;
 
+BENCHMARK(reorder_plan<neo::complex64>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
+BENCHMARK(reorder_plan<neo::complex128>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
+BENCHMARK(reorder_inline<neo::complex64>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
+BENCHMARK(reorder_inline<neo::complex128>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
+
 BENCHMARK(c2c<c2c_dit2_plan<neo::complex64, kernel::c2c_dit2_v1>>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
 BENCHMARK(c2c<c2c_dit2_plan<neo::complex64, kernel::c2c_dit2_v2>>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
 BENCHMARK(c2c<c2c_dit2_plan<neo::complex64, kernel::c2c_dit2_v3>>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
 BENCHMARK(c2c<c2c_dit2_plan<neo::complex64, kernel::c2c_dit2_v4>>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
 
+BENCHMARK(c2c_rows<c2c_dit2_plan<neo::complex64>>)->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {16, 64}});
+BENCHMARK(c2c_batch<c2c_dit2_plan<neo::complex64>, stdex::layout_right>)
+    ->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {16, 64}});
+BENCHMARK(c2c_batch<c2c_dit2_plan<neo::complex64>, stdex::layout_left>)
+    ->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {16, 64}});
+
 BENCHMARK(c2c_r4<c2c_dit4_plan<neo::complex64>>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
 BENCHMARK(c2c_r4<c2c_dif4_plan<neo::complex64>>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
 
 BENCHMARK(c2c<c2c_stockham_dif2r_plan<neo::complex64>>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
 BENCHMARK(c2c<c2c_stockham_dif2i_plan<neo::complex64>>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
 
+BENCHMARK(c2c<c2c_four_step_plan<neo::complex64>>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
+BENCHMARK(c2c_threaded<c2c_four_step_plan<neo::complex64>>)
+    ->UseRealTime()
+    ->ArgsProduct({benchmark::CreateRange(1 << 16, 1 << 22, 4), {1, 2, 4, 8}});
+
 BENCHMARK(c2c<fft_plan<neo::complex64>>)->RangeMultiplier(4)->Range(1 << 8, 1 << 20);
 
 #if defined(NEO_HAS_APPLE_ACCELERATE)
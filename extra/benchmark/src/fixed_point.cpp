@@ -346,6 +346,63 @@ private:
     std::vector<FixedPoint> _out;
 };
 
+template<typename FixedPoint, std::size_t Size>
+struct fixed_point_cmac
+{
+    explicit fixed_point_cmac() : _x(Size), _y(Size), _acc(Size)
+    {
+        auto rng  = std::mt19937{std::random_device{}()};
+        auto dist = std::uniform_real_distribution<float>{-0.5F, 0.5F};
+        auto gen  = [&] { return neo::fixed_point_complex<FixedPoint>{FixedPoint{dist(rng)}, FixedPoint{dist(rng)}}; };
+        std::generate(_x.begin(), _x.end(), gen);
+        std::generate(_y.begin(), _y.end(), gen);
+    }
+
+    auto operator()() -> void
+    {
+        auto const x   = stdex::mdspan{_x.data(), stdex::extents{Size}};
+        auto const y   = stdex::mdspan{_y.data(), stdex::extents{Size}};
+        auto const acc = stdex::mdspan{_acc.data(), stdex::extents{Size}};
+        neo::multiply_add(x, y, acc, acc);
+        neo::do_not_optimize(_acc[0]);
+    }
+
+private:
+    std::vector<neo::fixed_point_complex<FixedPoint>> _x;
+    std::vector<neo::fixed_point_complex<FixedPoint>> _y;
+    std::vector<neo::fixed_point_complex<FixedPoint>> _acc;
+};
+
+template<typename FixedPoint, std::size_t Size>
+struct fixed_point_split_cmac
+{
+    explicit fixed_point_split_cmac() : _x(2, Size), _y(2, Size), _acc(2, Size)
+    {
+        auto rng  = std::mt19937{std::random_device{}()};
+        auto dist = std::uniform_real_distribution<float>{-0.5F, 0.5F};
+        std::generate(_x.data(), _x.data() + _x.size(), [&] { return FixedPoint{dist(rng)}; });
+        std::generate(_y.data(), _y.data() + _y.size(), [&] { return FixedPoint{dist(rng)}; });
+    }
+
+    auto operator()() -> void
+    {
+        auto const split = [](auto& array) {
+            return neo::split_complex{
+                stdex::submdspan(array.to_mdspan(), 0, stdex::full_extent),
+                stdex::submdspan(array.to_mdspan(), 1, stdex::full_extent),
+            };
+        };
+
+        neo::multiply_add(split(_x), split(_y), split(_acc), split(_acc));
+        neo::do_not_optimize(_acc(0, 0));
+    }
+
+private:
+    stdex::mdarray<FixedPoint, stdex::dextents<size_t, 2>> _x;
+    stdex::mdarray<FixedPoint, stdex::dextents<size_t, 2>> _y;
+    stdex::mdarray<FixedPoint, stdex::dextents<size_t, 2>> _acc;
+};
+
 #if defined(NEO_HAS_BUILTIN_FLOAT16) and defined(NEO_HAS_ISA_F16C)
 template<std::size_t Size>
 struct float16_mul_bench
@@ -420,6 +477,14 @@ auto main() -> int
     timeit("cmul(std::complex<double>): ", 16, n, float_mul<std::complex<double>, n>{});
     std::puts("\n");
 
+    timeit("cmul(complex_q15):          ", 4, n, fixed_point_mul<neo::complex_q15, n>{});
+    timeit("cmul(complex_q31):          ", 8, n, fixed_point_mul<neo::complex_q31, n>{});
+    timeit("cmac(complex_q15):          ", 4, n, fixed_point_cmac<neo::q15, n>{});
+    timeit("cmac(complex_q31):          ", 8, n, fixed_point_cmac<neo::q31, n>{});
+    timeit("cmac(split<q15>):           ", 4, n, fixed_point_split_cmac<neo::q15, n>{});
+    timeit("cmac(split<q31>):           ", 8, n, fixed_point_split_cmac<neo::q31, n>{});
+    std::puts("\n");
+
     // timeit("cmulp(q7):       ", 2, n, cmulp<neo::q7, n>{});
     // timeit("cmulp(q15):      ", 4, n, cmulp<neo::q15, n>{});
     // timeit("cmulp(fxp_14):   ", 4, n, cmulp<neo::fixed_point<int16_t, 14>, n>{});
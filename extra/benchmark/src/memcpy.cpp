@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 
+#include <neo/algorithm.hpp>
 #include <neo/fft.hpp>
 
 #include <neo/testing/testing.hpp>
@@ -28,6 +29,47 @@ auto copy(benchmark::State& state) -> void
     state.SetBytesProcessed(items * sizeof(ValueType));
 }
 
+template<typename ValueType>
+auto neo_copy(benchmark::State& state) -> void
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+
+    auto src = stdex::mdarray<ValueType, stdex::dextents<size_t, 1>>{size};
+    auto dst = stdex::mdarray<ValueType, stdex::dextents<size_t, 1>>{size};
+    neo::fill(src.to_mdspan(), ValueType{1});
+
+    for (auto _ : state) {
+        neo::copy(src.to_mdspan(), dst.to_mdspan());
+        benchmark::DoNotOptimize(dst(0));
+        benchmark::ClobberMemory();
+    }
+
+    auto const items = int64_t(state.iterations()) * int64_t(size);
+    state.SetItemsProcessed(items);
+    state.SetBytesProcessed(items * sizeof(ValueType));
+}
+
+template<typename ValueType>
+auto neo_copy_matrix(benchmark::State& state) -> void
+{
+    auto const rows = static_cast<std::size_t>(state.range(0));
+    auto const cols = static_cast<std::size_t>(state.range(1));
+
+    auto src = stdex::mdarray<ValueType, stdex::dextents<size_t, 2>>{rows, cols};
+    auto dst = stdex::mdarray<ValueType, stdex::dextents<size_t, 2>>{rows, cols};
+    neo::fill(src.to_mdspan(), ValueType{1});
+
+    for (auto _ : state) {
+        neo::copy(src.to_mdspan(), dst.to_mdspan());
+        benchmark::DoNotOptimize(dst(0, 0));
+        benchmark::ClobberMemory();
+    }
+
+    auto const items = int64_t(state.iterations()) * int64_t(rows * cols);
+    state.SetItemsProcessed(items);
+    state.SetBytesProcessed(items * sizeof(ValueType));
+}
+
 }  // namespace
 
 BENCHMARK(copy<char>)->RangeMultiplier(2)->Range(1 << 7, 1 << 24);
@@ -35,4 +77,9 @@ BENCHMARK(copy<int>)->RangeMultiplier(2)->Range(1 << 7, 1 << 24);
 BENCHMARK(copy<float>)->RangeMultiplier(2)->Range(1 << 7, 1 << 24);
 BENCHMARK(copy<std::complex<float>>)->RangeMultiplier(2)->Range(1 << 7, 1 << 24);
 
+BENCHMARK(neo_copy<float>)->RangeMultiplier(2)->Range(1 << 7, 1 << 24);
+BENCHMARK(neo_copy<std::complex<float>>)->RangeMultiplier(2)->Range(1 << 7, 1 << 24);
+BENCHMARK(neo_copy_matrix<float>)->Args({2, 513})->Args({16, 1025})->Args({64, 4096});
+BENCHMARK(neo_copy_matrix<std::complex<float>>)->Args({2, 513})->Args({16, 1025})->Args({64, 4096});
+
 BENCHMARK_MAIN();
@@ -29,6 +29,65 @@ auto multiply(benchmark::State& state) -> void
     state.SetBytesProcessed(items * sizeof(Type));
 }
 
+template<typename Type>
+auto multiply_matrix(benchmark::State& state) -> void
+{
+    auto const rows = static_cast<size_t>(state.range(0));
+    auto const cols = static_cast<size_t>(state.range(1));
+    auto const lhs  = neo::generate_noise_signal<Type>(rows * cols, std::random_device{}());
+    auto const rhs  = neo::generate_noise_signal<Type>(rows * cols, std::random_device{}());
+
+    auto const x = stdex::mdspan{lhs.data(), stdex::extents{rows, cols}};
+    auto const y = stdex::mdspan{rhs.data(), stdex::extents{rows, cols}};
+    auto out     = stdex::mdarray<Type, stdex::dextents<size_t, 2>>{rows, cols};
+
+    for (auto _ : state) {
+        neo::multiply(x, y, out.to_mdspan());
+        benchmark::DoNotOptimize(out(0, 0));
+        benchmark::ClobberMemory();
+    }
+
+    auto const items = static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(rows * cols);
+    state.SetItemsProcessed(items);
+    state.SetBytesProcessed(items * sizeof(Type));
+}
+
+template<typename Type>
+auto add(benchmark::State& state) -> void
+{
+    auto const size = state.range(0);
+    auto const lhs  = neo::generate_noise_signal<Type>(size, std::random_device{}());
+    auto out        = neo::generate_noise_signal<Type>(size, std::random_device{}());
+
+    // In-place, like the overlap of overlap_add
+    for (auto _ : state) {
+        neo::add(lhs.to_mdspan(), out.to_mdspan(), out.to_mdspan());
+        benchmark::DoNotOptimize(out(0));
+        benchmark::ClobberMemory();
+    }
+
+    auto const items = static_cast<int64_t>(state.iterations()) * size;
+    state.SetItemsProcessed(items);
+    state.SetBytesProcessed(items * sizeof(Type));
+}
+
+template<typename Type>
+auto scale(benchmark::State& state) -> void
+{
+    auto const size = state.range(0);
+    auto buf        = neo::generate_noise_signal<Type>(size, std::random_device{}());
+
+    for (auto _ : state) {
+        neo::scale(Type(0.5), buf.to_mdspan());
+        benchmark::DoNotOptimize(buf(0));
+        benchmark::ClobberMemory();
+    }
+
+    auto const items = static_cast<int64_t>(state.iterations()) * size;
+    state.SetItemsProcessed(items);
+    state.SetBytesProcessed(items * sizeof(Type));
+}
+
 }  // namespace
 
 BENCHMARK(multiply<float>)->RangeMultiplier(2)->Range(1 << 7, 1 << 20);
@@ -36,4 +95,10 @@ BENCHMARK(multiply<double>)->RangeMultiplier(2)->Range(1 << 7, 1 << 20);
 BENCHMARK(multiply<neo::q7>)->RangeMultiplier(2)->Range(1 << 7, 1 << 20);
 BENCHMARK(multiply<neo::q15>)->RangeMultiplier(2)->Range(1 << 7, 1 << 20);
 BENCHMARK(multiply<neo::fixed_point<int16_t, 14>>)->RangeMultiplier(2)->Range(1 << 7, 1 << 20);
+BENCHMARK(multiply_matrix<float>)->Args({2, 513})->Args({16, 1025})->Args({64, 4096});
+BENCHMARK(multiply_matrix<double>)->Args({2, 513})->Args({16, 1025})->Args({64, 4096});
+BENCHMARK(add<float>)->RangeMultiplier(2)->Range(1 << 7, 1 << 20);
+BENCHMARK(add<double>)->RangeMultiplier(2)->Range(1 << 7, 1 << 20);
+BENCHMARK(scale<float>)->RangeMultiplier(2)->Range(1 << 7, 1 << 20);
+BENCHMARK(scale<double>)->RangeMultiplier(2)->Range(1 << 7, 1 << 20);
 BENCHMARK_MAIN();
@@ -6,6 +6,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+
 namespace {
 
 template<typename Plan>
@@ -39,6 +41,68 @@ auto r2c(benchmark::State& state) -> void
     state.counters["flop"] = benchmark::Counter(static_cast<double>(flop), benchmark::Counter::kIsRate);
 }
 
+// Second argument: number of rows, the batched call pairs them up into complex transforms
+template<typename Plan, bool Batched>
+auto r2c_rows(benchmark::State& state) -> void
+{
+    using Complex = typename Plan::complex_type;
+    using Float   = typename Plan::real_type;
+
+    auto const len   = static_cast<std::size_t>(state.range(0));
+    auto const rows  = static_cast<std::size_t>(state.range(1));
+    auto const order = neo::fft::next_order(len);
+    auto const noise = neo::generate_noise_signal<Float>(len * rows, std::random_device{}());
+
+    auto plan   = Plan{neo::fft::from_order, order};
+    auto input  = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{rows, plan.size()};
+    auto output = stdex::mdarray<Complex, stdex::dextents<size_t, 2>>{rows, plan.size() / 2 + 1};
+    std::copy(noise.data(), noise.data() + noise.size(), input.data());
+
+    for (auto _ : state) {
+        if constexpr (Batched) {
+            neo::fft::rfft(plan, input.to_mdspan(), output.to_mdspan());
+        } else {
+            for (auto row = std::size_t(0); row < rows; ++row) {
+                neo::fft::rfft(
+                    plan,
+                    stdex::submdspan(input.to_mdspan(), row, stdex::full_extent),
+                    stdex::submdspan(output.to_mdspan(), row, stdex::full_extent)
+                );
+            }
+        }
+
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    auto const flop        = 5UL * plan.size() * size_t(plan.order()) * rows * static_cast<size_t>(state.iterations());
+    state.counters["flop"] = benchmark::Counter(static_cast<double>(flop), benchmark::Counter::kIsRate);
+}
+
+template<typename Float>
+auto c2r_pruned(benchmark::State& state) -> void
+{
+    using Complex = std::complex<Float>;
+
+    auto const len     = static_cast<std::size_t>(state.range(0));
+    auto const order   = neo::fft::next_order(len);
+    auto const noise   = neo::generate_noise_signal<Float>(len, std::random_device{}());
+    auto const max_bin = len / static_cast<std::size_t>(state.range(1));
+
+    auto plan     = neo::fft::pruned_rfft_plan<Float, Complex>{neo::fft::from_order, order};
+    auto output   = noise;
+    auto spectrum = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>{plan.size() / 2 + 1};
+    neo::fft::rfft(plan, noise.to_mdspan(), spectrum.to_mdspan());
+    neo::fill(stdex::submdspan(spectrum.to_mdspan(), std::tuple{max_bin + 1, spectrum.extent(0)}), Complex{});
+
+    for (auto _ : state) {
+        plan(spectrum.to_mdspan(), output.to_mdspan(), max_bin);
+
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+}
+
 }  // namespace
 
 #if defined(NEO_HAS_INTEL_IPP)
@@ -52,4 +116,11 @@ BENCHMARK(r2c<neo::fft::fallback_rfft_plan<double>>)->RangeMultiplier(2)->Range(
 BENCHMARK(r2c<neo::fft::rfft_plan<float>>)->RangeMultiplier(2)->Range(1 << 8, 1 << 15);
 BENCHMARK(r2c<neo::fft::rfft_plan<double>>)->RangeMultiplier(2)->Range(1 << 8, 1 << 15);
 
+BENCHMARK(r2c_rows<neo::fft::fallback_rfft_plan<float>, false>)->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {16, 64}});
+BENCHMARK(r2c_rows<neo::fft::fallback_rfft_plan<float>, true>)->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {16, 64}});
+
+// Second argument: size / max_bin, 2 is a full inverse transform
+BENCHMARK(c2r_pruned<float>)->ArgsProduct({{1 << 10, 1 << 12, 1 << 14}, {2, 8, 32, 128}});
+BENCHMARK(c2r_pruned<double>)->ArgsProduct({{1 << 10, 1 << 12, 1 << 14}, {2, 8, 32, 128}});
+
 BENCHMARK_MAIN();
@@ -0,0 +1,395 @@
+// SPDX-License-Identifier: MIT
+
+#include "analyze.hpp"
+
+#include "wav.hpp"
+
+#include <neo/algorithm.hpp>
+#include <neo/container.hpp>
+#include <neo/convolution.hpp>
+#include <neo/fft.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <fmt/format.h>
+#include <fmt/os.h>
+
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string_view>
+#include <system_error>
+
+namespace neo {
+
+namespace {
+
+namespace conv = neo::convolution;
+
+using Complex    = std::complex<float>;
+using partitions = stdex::mdarray<Complex, stdex::dextents<std::size_t, 3>>;
+
+auto print_usage() -> void
+{
+    fmt::println("Usage: ./neo_convolver analyze path/to/filter.wav [options]");
+    fmt::println("  --format=json|csv           Report format (default: json)");
+    fmt::println("  --output=path               Write the report to a file instead of stdout");
+    fmt::println("  --thresholds=-20,-40,...    Perceptual thresholds in dB (default: -10 to -100)");
+    fmt::println("  --block-size=512            Partition size in samples");
+    fmt::println("  --low-bins=2                Number of low bins that are always kept");
+    fmt::println("  --seconds=5                 Length of the noise signal used for timing & error");
+}
+
+template<typename T>
+[[nodiscard]] auto parse_number(std::string_view str) -> std::optional<T>
+{
+    auto value        = T{};
+    auto const* first = str.data();
+    auto const* last  = std::next(str.data(), static_cast<std::ptrdiff_t>(str.size()));
+    auto const result = std::from_chars(first, last, value);
+    if (result.ec != std::errc{} or result.ptr != last) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+[[nodiscard]] auto parse_thresholds(std::string_view str) -> std::optional<std::vector<float>>
+{
+    auto thresholds = std::vector<float>{};
+    while (not str.empty()) {
+        auto const comma = str.find(',');
+        auto const value = parse_number<float>(str.substr(0, comma));
+        if (not value or not std::isfinite(*value)) {
+            return std::nullopt;
+        }
+
+        thresholds.push_back(*value);
+        str = comma == std::string_view::npos ? std::string_view{} : str.substr(comma + 1);
+    }
+
+    if (thresholds.empty()) {
+        return std::nullopt;
+    }
+    return thresholds;
+}
+
+// Processes a whole channel, the length must be a multiple of the block size
+template<typename Convolver, inout_vector Vec>
+auto process(Convolver& convolver, Vec channel, std::size_t block_size) -> void
+{
+    for (auto i = std::size_t(0); i < channel.extent(0); i += block_size) {
+        convolver(stdex::submdspan(channel, std::tuple{i, i + block_size}));
+    }
+}
+
+[[nodiscard]] auto dense_reference(partitions const& filter, audio_buffer<float> const& signal, std::size_t block_size)
+    -> audio_buffer<float>
+{
+    auto output = signal;
+    for (auto ch = std::size_t(0); ch < output.extent(0); ++ch) {
+        auto const full = stdex::full_extent;
+        auto convolver  = conv::upols_convolver<Complex>{};
+        convolver.filter(stdex::submdspan(filter.to_mdspan(), ch, full, full));
+        process(convolver, stdex::submdspan(output.to_mdspan(), ch, full), block_size);
+    }
+    return output;
+}
+
+[[nodiscard]] auto analyze_threshold(
+    partitions const& filter,
+    audio_buffer<float> const& signal,
+    audio_buffer<float> const& expected,
+    analyze_options const& options,
+    double sample_rate,
+    float threshold
+) -> sparsity_report
+{
+    auto const full           = stdex::full_extent;
+    auto const num_partitions = filter.extent(1);
+    auto const num_bins       = filter.extent(2);
+
+    auto report             = sparsity_report{};
+    report.threshold        = threshold;
+    report.total_bins       = filter.extent(0) * num_partitions * num_bins;
+    report.total_partitions = filter.extent(0) * num_partitions;
+
+    auto output = signal;
+    auto mask   = stdex::mdarray<std::uint8_t, stdex::dextents<std::size_t, 2>>{num_partitions, num_bins};
+
+    for (auto ch = std::size_t(0); ch < filter.extent(0); ++ch) {
+        auto const channel    = stdex::submdspan(filter.to_mdspan(), ch, full, full);
+        auto const importance = conv::a_weighted_importance<float>{channel, sample_rate, options.low_bins_to_keep};
+        auto const thresholds = importance.power_thresholds(threshold);
+        conv::sparsity_mask(channel, thresholds.to_mdspan(), mask.to_mdspan());
+
+        for (auto p = std::size_t(0); p < num_partitions; ++p) {
+            auto kept = std::size_t(0);
+            for (auto bin = std::size_t(0); bin < num_bins; ++bin) {
+                kept += static_cast<std::size_t>(mask(p, bin) != 0);
+            }
+            report.kept_bins += kept;
+            report.empty_partitions += static_cast<std::size_t>(kept == 0);
+        }
+
+        auto convolver = conv::sparse_upols_convolver<Complex>{};
+        convolver.filter(channel, mask.to_mdspan());
+
+        auto const start = std::chrono::steady_clock::now();
+        process(convolver, stdex::submdspan(output.to_mdspan(), ch, full), options.block_size);
+        auto const stop = std::chrono::steady_clock::now();
+        report.seconds += std::chrono::duration<double>(stop - start).count();
+    }
+
+    // Every kept bin is one complex multiply-add per block
+    auto const num_blocks     = static_cast<double>(signal.extent(1) / options.block_size);
+    auto const signal_seconds = static_cast<double>(signal.extent(1)) / sample_rate;
+    report.macs_per_block     = report.kept_bins;
+    report.realtime_factor    = signal_seconds / report.seconds;
+    report.macs_per_second    = static_cast<double>(report.macs_per_block) * num_blocks / report.seconds;
+    report.rmse               = static_cast<double>(root_mean_squared_error(output.to_mdspan(), expected.to_mdspan()));
+
+    auto signal_power = 0.0;
+    auto error_power  = 0.0;
+    for (auto ch = std::size_t(0); ch < output.extent(0); ++ch) {
+        for (auto i = std::size_t(0); i < output.extent(1); ++i) {
+            auto const error = static_cast<double>(output(ch, i)) - static_cast<double>(expected(ch, i));
+            signal_power += static_cast<double>(expected(ch, i)) * static_cast<double>(expected(ch, i));
+            error_power += error * error;
+        }
+    }
+    report.snr_db = error_power > 0.0 ? 10.0 * std::log10(signal_power / error_power)
+                                      : std::numeric_limits<double>::infinity();
+
+    // Perceptual metrics are averaged over the channels
+    auto const num_channels = static_cast<double>(output.extent(0));
+    for (auto ch = std::size_t(0); ch < output.extent(0); ++ch) {
+        auto metric = fft::perceptual_error<float>{fft::from_order, 10, sample_rate};
+        metric(stdex::submdspan(expected.to_mdspan(), ch, full), stdex::submdspan(output.to_mdspan(), ch, full));
+        report.a_weighted_error_db += static_cast<double>(metric.a_weighted_error()) / num_channels;
+        report.log_spectral_distance_db += static_cast<double>(metric.log_spectral_distance()) / num_channels;
+        report.segmental_snr_db += static_cast<double>(metric.segmental_snr()) / num_channels;
+    }
+
+    return report;
+}
+
+// JSON has no infinity, an exact result is reported as null
+[[nodiscard]] auto json_number(double value) -> std::string
+{
+    return std::isfinite(value) ? fmt::format("{:.6g}", value) : std::string{"null"};
+}
+
+// Quotes & escapes the string, control characters become \u00XX
+[[nodiscard]] auto json_string(std::string_view str) -> std::string
+{
+    auto out = std::string{"\""};
+    for (auto const c : str) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += fmt::format("\\u{:04x}", static_cast<unsigned>(c));
+                } else {
+                    out += c;
+                }
+                break;
+        }
+    }
+    out += '"';
+    return out;
+}
+
+[[nodiscard]] auto to_json(std::vector<sparsity_report> const& reports, analyze_options const& options, double sample_rate)
+    -> std::string
+{
+    auto out = fmt::format(
+        "{{\n  \"filter\": {},\n  \"sample_rate\": {},\n  \"block_size\": {},\n  \"results\": [\n",
+        json_string(options.filter.generic_string()),
+        json_number(sample_rate),
+        options.block_size
+    );
+
+    for (auto i = std::size_t(0); i < reports.size(); ++i) {
+        auto const& r = reports[i];
+        out += fmt::format(
+            "    {{\"threshold_db\": {}, \"kept_bins\": {}, \"total_bins\": {}, \"kept_ratio\": {}, "
+            "\"empty_partitions\": {}, \"total_partitions\": {}, \"macs_per_block\": {}, "
+            "\"realtime_factor\": {}, \"macs_per_second\": {}, \"rmse\": {}, \"snr_db\": {}, "
+            "\"a_weighted_error_db\": {}, \"log_spectral_distance_db\": {}, \"segmental_snr_db\": {}}}{}\n",
+            json_number(r.threshold),
+            r.kept_bins,
+            r.total_bins,
+            json_number(static_cast<double>(r.kept_bins) / static_cast<double>(r.total_bins)),
+            r.empty_partitions,
+            r.total_partitions,
+            r.macs_per_block,
+            json_number(r.realtime_factor),
+            json_number(r.macs_per_second),
+            json_number(r.rmse),
+            json_number(r.snr_db),
+            json_number(r.a_weighted_error_db),
+            json_number(r.log_spectral_distance_db),
+            json_number(r.segmental_snr_db),
+            i + 1 == reports.size() ? "" : ","
+        );
+    }
+
+    out += "  ]\n}\n";
+    return out;
+}
+
+[[nodiscard]] auto to_csv(std::vector<sparsity_report> const& reports) -> std::string
+{
+    auto out = std::string{
+        "threshold_db,kept_bins,total_bins,kept_ratio,empty_partitions,total_partitions,"
+        "macs_per_block,realtime_factor,macs_per_second,rmse,snr_db,"
+        "a_weighted_error_db,log_spectral_distance_db,segmental_snr_db\n"
+    };
+
+    for (auto const& r : reports) {
+        out += fmt::format(
+            "{},{},{},{:.6g},{},{},{},{:.6g},{:.6g},{:.6g},{:.6g},{:.6g},{:.6g},{:.6g}\n",
+            r.threshold,
+            r.kept_bins,
+            r.total_bins,
+            static_cast<double>(r.kept_bins) / static_cast<double>(r.total_bins),
+            r.empty_partitions,
+            r.total_partitions,
+            r.macs_per_block,
+            r.realtime_factor,
+            r.macs_per_second,
+            r.rmse,
+            r.snr_db,
+            r.a_weighted_error_db,
+            r.log_spectral_distance_db,
+            r.segmental_snr_db
+        );
+    }
+
+    return out;
+}
+
+}  // namespace
+
+auto parse_analyze_options(std::span<char const* const> args) -> std::optional<analyze_options>
+{
+    if (args.empty()) {
+        return std::nullopt;
+    }
+
+    auto options   = analyze_options{};
+    options.filter = args[0];
+
+    for (auto const* arg : args.subspan(1)) {
+        auto const str = std::string_view{arg};
+        auto const eq  = str.find('=');
+        if (not str.starts_with("--") or eq == std::string_view::npos) {
+            fmt::println("Invalid argument: {}", str);
+            return std::nullopt;
+        }
+
+        auto const key   = str.substr(2, eq - 2);
+        auto const value = str.substr(eq + 1);
+        auto valid       = true;
+
+        if (key == "format") {
+            options.format = value;
+            valid          = value == "json" or value == "csv";
+        } else if (key == "output") {
+            options.output = std::filesystem::path{value};
+        } else if (key == "thresholds") {
+            auto const thresholds = parse_thresholds(value);
+            valid                 = thresholds.has_value();
+            options.thresholds    = thresholds.value_or(options.thresholds);
+        } else if (key == "block-size") {
+            auto const size    = parse_number<std::size_t>(value);
+            valid              = size.has_value() and *size > 0;
+            options.block_size = size.value_or(options.block_size);
+        } else if (key == "low-bins") {
+            auto const bins          = parse_number<std::size_t>(value);
+            valid                    = bins.has_value();
+            options.low_bins_to_keep = bins.value_or(options.low_bins_to_keep);
+        } else if (key == "seconds") {
+            auto const seconds     = parse_number<double>(value);
+            valid                  = seconds.has_value() and *seconds > 0.0;
+            options.signal_seconds = seconds.value_or(options.signal_seconds);
+        } else {
+            valid = false;
+        }
+
+        if (not valid) {
+            fmt::println("Invalid argument: {}", str);
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}
+
+auto analyze(std::span<char const* const> args) -> int
+{
+    auto const options = parse_analyze_options(args);
+    if (not options) {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    auto [impulse, sample_rate] = load_wav_file<float>(options->filter);
+    if (impulse.size() == 0) {
+        return EXIT_FAILURE;
+    }
+
+    conv::normalize_impulse(impulse.to_mdspan());
+    auto const filter = conv::uniform_partition(impulse.to_mdspan(), options->block_size);
+    if (options->low_bins_to_keep > filter.extent(2)) {
+        fmt::println("Invalid argument: --low-bins must not exceed {}", filter.extent(2));
+        return EXIT_FAILURE;
+    }
+
+    // Same noise on every channel, trimmed to whole blocks
+    auto const num_blocks = std::max(
+        static_cast<std::size_t>(options->signal_seconds * sample_rate) / options->block_size,
+        std::size_t(1)
+    );
+    auto const noise = generate_noise_signal<float>(num_blocks * options->block_size, 42U);
+    auto signal      = audio_buffer<float>{impulse.extent(0), noise.extent(0)};
+    for (auto ch = std::size_t(0); ch < signal.extent(0); ++ch) {
+        copy(noise.to_mdspan(), stdex::submdspan(signal.to_mdspan(), ch, stdex::full_extent));
+    }
+
+    auto const expected = dense_reference(filter, signal, options->block_size);
+
+    auto reports = std::vector<sparsity_report>{};
+    for (auto threshold : options->thresholds) {
+        reports.push_back(analyze_threshold(filter, signal, expected, *options, sample_rate, threshold));
+    }
+
+    auto const report = options->format == "csv" ? to_csv(reports) : to_json(reports, *options, sample_rate);
+    if (options->output) {
+        try {
+            auto file = fmt::output_file(options->output->string());
+            file.print("{}", report);
+
+            // Flushes here, a write error in the destructor would terminate
+            file.close();
+        } catch (std::system_error const& error) {
+            fmt::println("Could not write the report: {}", error.what());
+            return EXIT_FAILURE;
+        }
+    } else {
+        fmt::print("{}", report);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+}  // namespace neo
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace neo {
+
+struct analyze_options
+{
+    std::filesystem::path filter;
+    std::optional<std::filesystem::path> output;
+    std::string format{"json"};
+    std::vector<float> thresholds{-10.0F, -20.0F, -30.0F, -40.0F, -50.0F, -60.0F, -70.0F, -80.0F, -90.0F, -100.0F};
+    std::size_t block_size{512};
+    std::size_t low_bins_to_keep{2};
+    double signal_seconds{5.0};
+};
+
+/// Result of a single threshold of the sweep, summed over all channels.
+struct sparsity_report
+{
+    float threshold{0};
+    std::size_t kept_bins{0};
+    std::size_t total_bins{0};
+    std::size_t macs_per_block{0};
+    std::size_t empty_partitions{0};
+    std::size_t total_partitions{0};
+    double seconds{0};
+    double realtime_factor{0};
+    double macs_per_second{0};
+    double rmse{0};
+    double snr_db{0};
+    double a_weighted_error_db{0};
+    double log_spectral_distance_db{0};
+    double segmental_snr_db{0};
+};
+
+[[nodiscard]] auto parse_analyze_options(std::span<char const* const> args) -> std::optional<analyze_options>;
+
+/// `neo-cli analyze`, sweeps the perceptual threshold and reports cost & error of the sparse convolver.
+[[nodiscard]] auto analyze(std::span<char const* const> args) -> int;
+
+}  // namespace neo
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 
+#include "analyze.hpp"
 #include "wav.hpp"
 
 #include <neo/algorithm.hpp>
@@ -11,6 +12,7 @@
 #include <fmt/os.h>
 
 #include <cstdlib>
+#include <string_view>
 
 namespace conv = neo::convolution;
 
@@ -38,6 +40,7 @@ convolve(neo::audio_buffer<float> const& signal, neo::audio_buffer<float> const&
         auto convolver  = Convolver{};
         auto const full = stdex::full_extent;
         convolver.filter(stdex::submdspan(partitions.to_mdspan(), channel, full, full));
+        convolver.set_flush_denormals(true);
 
         for (auto i{0}; std::cmp_less(i, output.extent(1)); i += block_size) {
             neo::fill(block_buffer.to_mdspan(), 0.0F);
@@ -61,8 +64,13 @@ auto main(int argc, char** argv) -> int
 {
     auto const args = std::span<char const* const>{argv, size_t(argc)};
 
+    if (args.size() >= 2 and std::string_view{args[1]} == "analyze") {
+        return neo::analyze(args.subspan(2));
+    }
+
     if (args.size() != 4) {
         fmt::println("Usage: ./neo_convolver path/to/signal.wav path/to/filter.wav path/to/output.wav");
+        fmt::println("       ./neo_convolver analyze path/to/filter.wav [options]");
         return EXIT_FAILURE;
     }
 
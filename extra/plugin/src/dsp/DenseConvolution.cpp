@@ -4,12 +4,10 @@
 
 #include "dsp/AudioBuffer.hpp"
 
-#include <neo/bit/bit_ceil.hpp>
 #include <neo/convolution/normalize_impulse.hpp>
+#include <neo/convolution/sparsity_budget.hpp>
+#include <neo/convolution/sparsity_mask.hpp>
 #include <neo/convolution/uniform_partition.hpp>
-#include <neo/fft/rfftfreq.hpp>
-#include <neo/math/a_weighting.hpp>
-#include <neo/unit/decibel.hpp>
 
 namespace neo {
 
@@ -107,20 +105,6 @@ auto DenseConvolution::updateImpulseResponse() -> void
     }
 }
 
-[[nodiscard]] static auto
-normalization_factor(stdex::mdspan<std::complex<float> const, stdex::dextents<size_t, 2>> filter) -> float
-{
-    auto maxPower = 0.0F;
-    for (auto p{0UL}; p < filter.extent(0); ++p) {
-        auto const partition = stdex::submdspan(filter, p, stdex::full_extent);
-        for (auto bin{0UL}; bin < filter.extent(1); ++bin) {
-            auto const amplitude = std::abs(partition(bin));
-            maxPower             = std::max(maxPower, amplitude * amplitude);
-        }
-    }
-    return 1.0F / maxPower;
-}
-
 auto sparse_convolve(
     juce::AudioBuffer<float> const& signal,
     juce::AudioBuffer<float> const& filter,
@@ -136,22 +120,9 @@ auto sparse_convolve(
     neo::convolution::normalize_impulse(matrix.to_mdspan());
     auto partitions = neo::convolution::uniform_partition(matrix.to_mdspan(), static_cast<std::size_t>(blockSize));
 
-    auto const K = neo::bit_ceil((partitions.extent(2) - 1U) * 2U);
+    jassert(std::cmp_less(lowBinsToKeep, partitions.extent(2)));
 
-    auto const weights = [K, bins = partitions.extent(2), lowBinsToKeep, sampleRate] {
-        jassert(std::cmp_less(lowBinsToKeep, bins));
-
-        auto w = std::vector<float>(bins);
-        std::fill(w.begin(), std::next(w.begin(), lowBinsToKeep), 100.0F);
-
-        for (auto i{lowBinsToKeep}; i < std::ssize(w); ++i) {
-            auto const frequency = neo::rfftfreq<float>(K, i, 1.0 / sampleRate);
-            auto const weight    = neo::a_weighting(frequency);
-
-            w[static_cast<std::size_t>(i)] = weight;
-        }
-        return w;
-    }();
+    auto mask = stdex::mdarray<std::uint8_t, stdex::dextents<size_t, 2>>{partitions.extent(1), partitions.extent(2)};
 
     for (auto ch{0}; ch < signal.getNumChannels(); ++ch) {
         auto convolver               = neo::convolution::sparse_upola_convolver<std::complex<float>>{};
@@ -159,16 +130,15 @@ auto sparse_convolve(
         auto const full              = stdex::full_extent;
         auto const channelPartitions = stdex::submdspan(partitions.to_mdspan(), channel, full, full);
 
-        auto const scale = normalization_factor(channelPartitions);
-
-        auto const isAboveThreshold = [thresholdDB, scale, &weights](auto /*row*/, auto col, auto bin) {
-            auto const gain  = std::abs(bin);
-            auto const power = gain * gain;
-            auto const dB    = amplitude_to_db(power * scale) * 0.5F + weights[col];
-            return dB > thresholdDB;
+        auto const importance = neo::convolution::a_weighted_importance<float>{
+            channelPartitions,
+            sampleRate,
+            static_cast<std::size_t>(lowBinsToKeep),
         };
+        auto const thresholds = importance.power_thresholds(thresholdDB);
 
-        convolver.filter(channelPartitions, isAboveThreshold);
+        neo::convolution::sparsity_mask(channelPartitions, thresholds.to_mdspan(), mask.to_mdspan());
+        convolver.filter(channelPartitions, mask.to_mdspan());
 
         auto const* const in = signal.getReadPointer(ch);
         auto* const out      = output.getWritePointer(ch);
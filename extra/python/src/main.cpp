@@ -3,6 +3,7 @@
 #include <neo/algorithm.hpp>
 #include <neo/complex.hpp>
 #include <neo/convolution.hpp>
+#include <neo/execution.hpp>
 #include <neo/fft.hpp>
 #include <neo/math.hpp>
 #include <neo/type_traits.hpp>
@@ -126,6 +127,15 @@ auto as_mdspan(py::array_t<T, Flags> buf, auto func)
     throw std::runtime_error("unsupported ndim: " + std::to_string(dim));
 }
 
+// Sizes from here on no longer fit into the L2 cache and are split across threads
+inline constexpr auto large_fft_order = std::size_t{18};
+
+[[nodiscard]] auto thread_pool() -> neo::thread_pool&
+{
+    static auto pool = neo::thread_pool{};
+    return pool;
+}
+
 template<neo::complex Complex, neo::fft::direction Dir>
 auto fft(py::array_t<Complex> array, std::optional<std::size_t> n, neo::fft::norm norm) -> py::array_t<Complex>
 {
@@ -144,17 +154,26 @@ auto fft(py::array_t<Complex> array, std::optional<std::size_t> n, neo::fft::nor
         {
             auto no_gil = py::gil_scoped_release{};
 
-            auto plan = neo::fft::fft_plan<Complex>{neo::fft::from_order, order};
-            if constexpr (Dir == neo::fft::direction::forward) {
-                neo::fft::fft(plan, input, out);
-                if (norm == neo::fft::norm::forward) {
-                    neo::scale(Float(1) / Float(size), out);
+            auto const transform = [&](auto& plan) {
+                if constexpr (Dir == neo::fft::direction::forward) {
+                    neo::fft::fft(plan, input, out);
+                    if (norm == neo::fft::norm::forward) {
+                        neo::scale(Float(1) / Float(size), out);
+                    }
+                } else {
+                    neo::fft::ifft(plan, input, out);
+                    if (norm == neo::fft::norm::backward) {
+                        neo::scale(Float(1) / Float(size), out);
+                    }
                 }
+            };
+
+            if (order >= large_fft_order) {
+                auto plan = neo::fft::c2c_four_step_plan<Complex>{neo::fft::from_order, order, thread_pool()};
+                transform(plan);
             } else {
-                neo::fft::ifft(plan, input, out);
-                if (norm == neo::fft::norm::backward) {
-                    neo::scale(Float(1) / Float(size), out);
-                }
+                auto plan = neo::fft::fft_plan<Complex>{neo::fft::from_order, order};
+                transform(plan);
             }
 
             if (norm == neo::fft::norm::ortho) {
@@ -6,6 +6,7 @@
 #include <neo/container/mdspan.hpp>
 
 #include <cassert>
+#include <cstddef>
 #include <utility>
 
 namespace neo::detail {
@@ -16,7 +17,18 @@ auto linalg_binary_op(InObj1 x, InObj2 y, OutObj out, Op op) noexcept -> void
 {
     assert(detail::extents_equal(x, y, out));
 
-    if constexpr (InObj1::rank() == 1) {
+    // Contiguous objects with the same element order are walked as one flat
+    // array, for matrices too. The plain pointer loop is what auto-vectorizes.
+    if constexpr (always_contiguous<InObj1, InObj2, OutObj>) {
+        auto const* x_ptr = x.data_handle();
+        auto const* y_ptr = y.data_handle();
+        auto* out_ptr     = out.data_handle();
+        auto const size   = static_cast<std::size_t>(x.size());
+
+        for (auto i = std::size_t(0); i < size; ++i) {
+            out_ptr[i] = op(x_ptr[i], y_ptr[i]);
+        }
+    } else if constexpr (InObj1::rank() == 1) {
         for (auto i{0}; std::cmp_less(i, x.extent(0)); ++i) {
             out[i] = op(x[i], y[i]);
         }
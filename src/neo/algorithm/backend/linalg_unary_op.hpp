@@ -5,6 +5,8 @@
 #include <neo/config.hpp>
 #include <neo/container/mdspan.hpp>
 
+#include <cstddef>
+
 namespace neo::detail {
 
 template<inout_object InOutObj, typename Op>
@@ -12,7 +14,13 @@ constexpr auto linalg_unary_op(InOutObj obj, Op op) noexcept -> void
 {
     using index_type = typename InOutObj::index_type;
 
-    if constexpr (InOutObj::rank() == 1) {
+    if constexpr (always_contiguous<InOutObj>) {
+        auto* ptr       = obj.data_handle();
+        auto const size = static_cast<std::size_t>(obj.size());
+        for (auto i = std::size_t(0); i < size; ++i) {
+            ptr[i] = op(ptr[i]);
+        }
+    } else if constexpr (InOutObj::rank() == 1) {
         for (index_type i{0}; i < obj.extent(0); ++i) {
             obj(i) = op(obj(i));
         }
@@ -11,9 +11,20 @@
 #include <neo/math/real.hpp>
 
 #include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <type_traits>
 
 namespace neo {
 
+/// Copy \f$out = in\f$
+///
+/// Contiguous views of the same value type may overlap, e.g. when shifting a
+/// delay line in-place, they are copied as if by memmove. All other views must
+/// not overlap.
+///
 /// \ingroup neo-linalg
 template<in_object InObj, out_object OutObj>
     requires(InObj::rank() == OutObj::rank())
@@ -21,7 +32,37 @@ constexpr auto copy(InObj in_obj, OutObj out_obj) noexcept -> void
 {
     assert(detail::extents_equal(in_obj, out_obj));
 
-    if constexpr (InObj::rank() == 1) {
+    if constexpr (always_contiguous<InObj, OutObj>) {
+        using InValue  = value_type_t<InObj>;
+        using OutValue = value_type_t<OutObj>;
+
+        auto const* in_ptr = in_obj.data_handle();
+        auto* out_ptr      = out_obj.data_handle();
+        auto const size    = static_cast<std::size_t>(in_obj.size());
+
+        if constexpr (std::same_as<InValue, OutValue>) {
+            if (not std::is_constant_evaluated()) {
+                if constexpr (std::is_trivially_copyable_v<InValue>) {
+                    if (size != 0) {
+                        std::memmove(out_ptr, in_ptr, size * sizeof(InValue));
+                    }
+                    return;
+                }
+
+                // Same as memmove, a destination behind the source is filled from the back
+                if (std::less{}(in_ptr, out_ptr)) {
+                    for (auto i = size; i > 0; --i) {
+                        out_ptr[i - 1] = in_ptr[i - 1];
+                    }
+                    return;
+                }
+            }
+        }
+
+        for (auto i = std::size_t(0); i < size; ++i) {
+            out_ptr[i] = in_ptr[i];
+        }
+    } else if constexpr (InObj::rank() == 1) {
         for (auto i{0ULL}; i < in_obj.extent(0); ++i) {
             out_obj[i] = in_obj[i];
         }
@@ -9,6 +9,9 @@
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 
+#include <string>
+#include <tuple>
+
 TEMPLATE_TEST_CASE("neo/algorithm: copy", "", float, double, std::complex<float>, std::complex<double>)
 {
     using Float     = neo::real_or_complex_value_t<TestType>;
@@ -41,4 +44,79 @@ TEMPLATE_TEST_CASE("neo/algorithm: copy", "", float, double, std::complex<float>
         neo::copy(in.to_mdspan(), out.to_mdspan());
         REQUIRE(neo::allclose(in.to_mdspan(), out.to_mdspan()));
     }
+
+    SECTION("layouts")
+    {
+        // Rectangular, so a flat copy between different layouts would transpose
+        auto const rows = std::size_t(3);
+
+        auto in = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{rows, size};
+        for (auto i = std::size_t(0); i < rows; ++i) {
+            for (auto j = std::size_t(0); j < size; ++j) {
+                in(i, j) = Float(static_cast<float>(i * size + j));
+            }
+        }
+
+        auto left = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>, stdex::layout_left>{rows, size};
+        neo::copy(in.to_mdspan(), left.to_mdspan());
+
+        auto right = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{rows, size};
+        neo::copy(left.to_mdspan(), right.to_mdspan());
+
+        auto wide    = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{rows, size * 2};
+        auto strided = stdex::submdspan(wide.to_mdspan(), stdex::full_extent, std::tuple{1, size + 1});
+        neo::copy(right.to_mdspan(), strided);
+
+        for (auto i = std::size_t(0); i < rows; ++i) {
+            for (auto j = std::size_t(0); j < size; ++j) {
+                REQUIRE(left(i, j) == in(i, j));
+                REQUIRE(right(i, j) == in(i, j));
+                REQUIRE(strided(i, j) == in(i, j));
+            }
+        }
+    }
+
+    SECTION("overlap")
+    {
+        auto buffer = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size + 1};
+        for (auto i = std::size_t(0); i < buffer.extent(0); ++i) {
+            buffer(i) = Float(static_cast<float>(i));
+        }
+
+        auto const head = stdex::submdspan(buffer.to_mdspan(), std::tuple{0, size});
+        auto const tail = stdex::submdspan(buffer.to_mdspan(), std::tuple{1, size + 1});
+
+        neo::copy(tail, head);
+        for (auto i = std::size_t(0); i < size; ++i) {
+            REQUIRE(buffer(i) == Float(static_cast<float>(i + 1)));
+        }
+
+        neo::copy(head, tail);
+        for (auto i = std::size_t(0); i < size; ++i) {
+            REQUIRE(buffer(i + 1) == Float(static_cast<float>(i + 1)));
+        }
+    }
+}
+
+TEST_CASE("neo/algorithm: copy(overlap, non-trivial)")
+{
+    auto const size = GENERATE(as<std::size_t>{}, 1, 2, 33);
+
+    auto buffer = stdex::mdarray<std::string, stdex::dextents<std::size_t, 1>>{size + 1};
+    for (auto i = std::size_t(0); i < buffer.extent(0); ++i) {
+        buffer(i) = std::to_string(i);
+    }
+
+    auto const head = stdex::submdspan(buffer.to_mdspan(), std::tuple{0, size});
+    auto const tail = stdex::submdspan(buffer.to_mdspan(), std::tuple{1, size + 1});
+
+    neo::copy(tail, head);
+    for (auto i = std::size_t(0); i < size; ++i) {
+        REQUIRE(buffer(i) == std::to_string(i + 1));
+    }
+
+    neo::copy(head, tail);
+    for (auto i = std::size_t(0); i < size; ++i) {
+        REQUIRE(buffer(i + 1) == std::to_string(i + 1));
+    }
 }
@@ -13,7 +13,7 @@ namespace neo {
 /// Multiply \f$out = x * y\f$
 /// \ingroup neo-linalg
 template<in_object InObj1, in_object InObj2, out_object OutObj>
-    requires(InObj1::rank() == InObj2::rank() and InObj1::rank() == OutObj::rank())
+    requires detail::all_same_rank<InObj1, InObj2, OutObj>
 auto multiply(InObj1 x, InObj2 y, OutObj out) noexcept -> void
 {
     return detail::linalg_binary_op(x, y, out, std::multiplies{});
@@ -4,10 +4,12 @@
 
 #include <neo/config.hpp>
 
+#include <neo/complex/complex.hpp>
 #include <neo/complex/split_complex.hpp>
 #include <neo/container/csr_matrix.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/simd/native.hpp>
+#include <neo/type_traits/value_type_t.hpp>
 
 #if defined(NEO_HAS_APPLE_ACCELERATE)
     #include <Accelerate/Accelerate.h>
@@ -17,13 +19,37 @@
     #include <neo/config/xsimd.hpp>
 #endif
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <complex>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 namespace neo::simd {
 
 namespace detail {
 
+/// out = x * y + z with two dependent FMAs per component
+template<typename Batch>
+NEO_ALWAYS_INLINE auto complex_multiply_add(
+    typename Batch::register_type xre,
+    typename Batch::register_type xim,
+    typename Batch::register_type yre,
+    typename Batch::register_type yim,
+    typename Batch::register_type& re,
+    typename Batch::register_type& im
+) noexcept -> void
+{
+    re = Batch::fmadd(xre, yre, Batch::fnmadd(xim, yim, re));
+    im = Batch::fmadd(xre, yim, Batch::fmadd(xim, yre, im));
+}
+
+/// The remainder of a loop is processed with one masked load & store per array.
+template<typename Batch>
+concept masked_batch = requires { typename Batch::mask_type; };
+
 template<typename Batch>
 auto multiply_add(
     typename Batch::float_type const* x_real,
@@ -38,26 +64,74 @@ auto multiply_add(
 ) -> void
 {
     using reg = Batch;
+    using vec = typename Batch::register_type;
 
-    auto const inc      = reg::size;
-    auto const vec_size = size - (size % inc);
+    static constexpr auto const inc    = reg::size;
+    static constexpr auto const unroll = reg::unroll;
+    static constexpr auto const step   = inc * unroll;
 
-    for (auto i = std::size_t(0); i < vec_size; i += inc) {
-        auto const xre = reg::loadu(&x_real[i]);
-        auto const xim = reg::loadu(&x_imag[i]);
-        auto const yre = reg::loadu(&y_real[i]);
-        auto const yim = reg::loadu(&y_imag[i]);
-        auto const zre = reg::loadu(&z_real[i]);
-        auto const zim = reg::loadu(&z_imag[i]);
+    auto i = std::size_t(0);
 
-        auto const out_re = reg::add(reg::sub(reg::mul(xre, yre), reg::mul(xim, yim)), zre);
-        auto const out_im = reg::add(reg::add(reg::mul(xre, yim), reg::mul(xim, yre)), zim);
+    // All loads of a step are issued before the first store, out may alias z
+    for (; i + step <= size; i += step) {
+        vec re[unroll];
+        vec im[unroll];
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            re[u] = reg::loadu(&z_real[i + u * inc]);
+            im[u] = reg::loadu(&z_imag[i + u * inc]);
+        }
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            auto const j = i + u * inc;
+            complex_multiply_add<reg>(
+                reg::loadu(&x_real[j]),
+                reg::loadu(&x_imag[j]),
+                reg::loadu(&y_real[j]),
+                reg::loadu(&y_imag[j]),
+                re[u],
+                im[u]
+            );
+        }
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            reg::storeu(&out_real[i + u * inc], re[u]);
+            reg::storeu(&out_imag[i + u * inc], im[u]);
+        }
+    }
 
-        reg::storeu(&out_real[i], out_re);
-        reg::storeu(&out_imag[i], out_im);
+    for (; i + inc <= size; i += inc) {
+        auto re = reg::loadu(&z_real[i]);
+        auto im = reg::loadu(&z_imag[i]);
+        complex_multiply_add<reg>(
+            reg::loadu(&x_real[i]),
+            reg::loadu(&x_imag[i]),
+            reg::loadu(&y_real[i]),
+            reg::loadu(&y_imag[i]),
+            re,
+            im
+        );
+        reg::storeu(&out_real[i], re);
+        reg::storeu(&out_imag[i], im);
     }
 
-    for (auto i = vec_size; i < size; ++i) {
+    if constexpr (masked_batch<reg>) {
+        if (i < size) {
+            auto const mask = reg::tail_mask(size - i);
+            auto re         = reg::maskz_loadu(mask, &z_real[i]);
+            auto im         = reg::maskz_loadu(mask, &z_imag[i]);
+            complex_multiply_add<reg>(
+                reg::maskz_loadu(mask, &x_real[i]),
+                reg::maskz_loadu(mask, &x_imag[i]),
+                reg::maskz_loadu(mask, &y_real[i]),
+                reg::maskz_loadu(mask, &y_imag[i]),
+                re,
+                im
+            );
+            reg::mask_storeu(&out_real[i], mask, re);
+            reg::mask_storeu(&out_imag[i], mask, im);
+        }
+        return;
+    }
+
+    for (; i < size; ++i) {
         auto const xre = x_real[i];
         auto const xim = x_imag[i];
         auto const yre = y_real[i];
@@ -68,6 +142,355 @@ auto multiply_add(
     }
 }
 
+/// acc += x * y, the accumulator is read & written through the same pointers
+template<typename Batch>
+auto multiply_accumulate(
+    typename Batch::float_type const* NEO_RESTRICT x_real,
+    typename Batch::float_type const* NEO_RESTRICT x_imag,
+    typename Batch::float_type const* NEO_RESTRICT y_real,
+    typename Batch::float_type const* NEO_RESTRICT y_imag,
+    typename Batch::float_type* NEO_RESTRICT acc_real,
+    typename Batch::float_type* NEO_RESTRICT acc_imag,
+    std::size_t size
+) -> void
+{
+    using reg = Batch;
+    using vec = typename Batch::register_type;
+
+    static constexpr auto const inc    = reg::size;
+    static constexpr auto const unroll = reg::unroll;
+    static constexpr auto const step   = inc * unroll;
+
+    auto i = std::size_t(0);
+
+    for (; i + step <= size; i += step) {
+        vec re[unroll];
+        vec im[unroll];
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            auto const j = i + u * inc;
+            re[u]        = reg::loadu(&acc_real[j]);
+            im[u]        = reg::loadu(&acc_imag[j]);
+            complex_multiply_add<reg>(
+                reg::loadu(&x_real[j]),
+                reg::loadu(&x_imag[j]),
+                reg::loadu(&y_real[j]),
+                reg::loadu(&y_imag[j]),
+                re[u],
+                im[u]
+            );
+        }
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            reg::storeu(&acc_real[i + u * inc], re[u]);
+            reg::storeu(&acc_imag[i + u * inc], im[u]);
+        }
+    }
+
+    for (; i + inc <= size; i += inc) {
+        auto re = reg::loadu(&acc_real[i]);
+        auto im = reg::loadu(&acc_imag[i]);
+        complex_multiply_add<reg>(
+            reg::loadu(&x_real[i]),
+            reg::loadu(&x_imag[i]),
+            reg::loadu(&y_real[i]),
+            reg::loadu(&y_imag[i]),
+            re,
+            im
+        );
+        reg::storeu(&acc_real[i], re);
+        reg::storeu(&acc_imag[i], im);
+    }
+
+    if constexpr (masked_batch<reg>) {
+        if (i < size) {
+            auto const mask = reg::tail_mask(size - i);
+            auto re         = reg::maskz_loadu(mask, &acc_real[i]);
+            auto im         = reg::maskz_loadu(mask, &acc_imag[i]);
+            complex_multiply_add<reg>(
+                reg::maskz_loadu(mask, &x_real[i]),
+                reg::maskz_loadu(mask, &x_imag[i]),
+                reg::maskz_loadu(mask, &y_real[i]),
+                reg::maskz_loadu(mask, &y_imag[i]),
+                re,
+                im
+            );
+            reg::mask_storeu(&acc_real[i], mask, re);
+            reg::mask_storeu(&acc_imag[i], mask, im);
+        }
+        return;
+    }
+
+    for (; i < size; ++i) {
+        auto const xre = x_real[i];
+        auto const xim = x_imag[i];
+        auto const yre = y_real[i];
+        auto const yim = y_imag[i];
+
+        acc_real[i] += xre * yre - xim * yim;
+        acc_imag[i] += xre * yim + xim * yre;
+    }
+}
+
+/// acc += x[0] * y[0] + ... + x[rows-1] * y[rows-1]
+///
+/// Each accumulator tile is loaded & stored once and stays in registers while
+/// all rows are summed into it.
+template<typename Batch>
+auto multiply_accumulate_rows(
+    typename Batch::float_type const* const* x_real,
+    typename Batch::float_type const* const* x_imag,
+    typename Batch::float_type const* const* y_real,
+    typename Batch::float_type const* const* y_imag,
+    std::size_t rows,
+    typename Batch::float_type* NEO_RESTRICT acc_real,
+    typename Batch::float_type* NEO_RESTRICT acc_imag,
+    std::size_t size
+) -> void
+{
+    using reg = Batch;
+    using vec = typename Batch::register_type;
+
+    static constexpr auto const inc    = reg::size;
+    static constexpr auto const unroll = reg::unroll;
+    static constexpr auto const step   = inc * unroll;
+
+    auto i = std::size_t(0);
+
+    for (; i + step <= size; i += step) {
+        vec re[unroll];
+        vec im[unroll];
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            re[u] = reg::loadu(&acc_real[i + u * inc]);
+            im[u] = reg::loadu(&acc_imag[i + u * inc]);
+        }
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            for (auto u = std::size_t(0); u < unroll; ++u) {
+                auto const j = i + u * inc;
+                complex_multiply_add<reg>(
+                    reg::loadu(&x_real[k][j]),
+                    reg::loadu(&x_imag[k][j]),
+                    reg::loadu(&y_real[k][j]),
+                    reg::loadu(&y_imag[k][j]),
+                    re[u],
+                    im[u]
+                );
+            }
+        }
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            reg::storeu(&acc_real[i + u * inc], re[u]);
+            reg::storeu(&acc_imag[i + u * inc], im[u]);
+        }
+    }
+
+    for (; i + inc <= size; i += inc) {
+        auto re = reg::loadu(&acc_real[i]);
+        auto im = reg::loadu(&acc_imag[i]);
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            complex_multiply_add<reg>(
+                reg::loadu(&x_real[k][i]),
+                reg::loadu(&x_imag[k][i]),
+                reg::loadu(&y_real[k][i]),
+                reg::loadu(&y_imag[k][i]),
+                re,
+                im
+            );
+        }
+        reg::storeu(&acc_real[i], re);
+        reg::storeu(&acc_imag[i], im);
+    }
+
+    if constexpr (masked_batch<reg>) {
+        if (i < size) {
+            auto const mask = reg::tail_mask(size - i);
+            auto re         = reg::maskz_loadu(mask, &acc_real[i]);
+            auto im         = reg::maskz_loadu(mask, &acc_imag[i]);
+            for (auto k = std::size_t(0); k < rows; ++k) {
+                complex_multiply_add<reg>(
+                    reg::maskz_loadu(mask, &x_real[k][i]),
+                    reg::maskz_loadu(mask, &x_imag[k][i]),
+                    reg::maskz_loadu(mask, &y_real[k][i]),
+                    reg::maskz_loadu(mask, &y_imag[k][i]),
+                    re,
+                    im
+                );
+            }
+            reg::mask_storeu(&acc_real[i], mask, re);
+            reg::mask_storeu(&acc_imag[i], mask, im);
+        }
+        return;
+    }
+
+    for (; i < size; ++i) {
+        auto re = acc_real[i];
+        auto im = acc_imag[i];
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            auto const xre = x_real[k][i];
+            auto const xim = x_imag[k][i];
+            auto const yre = y_real[k][i];
+            auto const yim = y_imag[k][i];
+
+            re += xre * yre - xim * yim;
+            im += xre * yim + xim * yre;
+        }
+        acc_real[i] = re;
+        acc_imag[i] = im;
+    }
+}
+
+/// acc += x * y on (re, im) pairs, the products are formed by duplicating y's parts & swapping x's
+template<typename Batch>
+NEO_ALWAYS_INLINE auto interleaved_complex_multiply_add(
+    typename Batch::register_type x,
+    typename Batch::register_type y,
+    typename Batch::register_type& acc
+) noexcept -> void
+{
+    // even: x.re * y.re - (x.im * y.im - acc.re), odd: x.im * y.re + (x.re * y.im + acc.im)
+    acc = Batch::fmaddsub(x, Batch::dup_real(y), Batch::fmaddsub(Batch::swap(x), Batch::dup_imag(y), acc));
+}
+
+/// out = x * y + z on interleaved complex values, size counts floats
+template<typename Batch>
+auto interleaved_multiply_add(
+    typename Batch::float_type const* x,
+    typename Batch::float_type const* y,
+    typename Batch::float_type const* z,
+    typename Batch::float_type* out,
+    std::size_t size
+) -> void
+{
+    using reg = Batch;
+    using vec = typename Batch::register_type;
+
+    static constexpr auto const inc    = reg::size;
+    static constexpr auto const unroll = reg::unroll;
+    static constexpr auto const step   = inc * unroll;
+
+    auto i = std::size_t(0);
+
+    // All loads of a step are issued before the first store, out may alias z
+    for (; i + step <= size; i += step) {
+        vec acc[unroll];
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            acc[u] = reg::loadu(&z[i + u * inc]);
+        }
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            auto const j = i + u * inc;
+            interleaved_complex_multiply_add<reg>(reg::loadu(&x[j]), reg::loadu(&y[j]), acc[u]);
+        }
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            reg::storeu(&out[i + u * inc], acc[u]);
+        }
+    }
+
+    for (; i + inc <= size; i += inc) {
+        auto acc = reg::loadu(&z[i]);
+        interleaved_complex_multiply_add<reg>(reg::loadu(&x[i]), reg::loadu(&y[i]), acc);
+        reg::storeu(&out[i], acc);
+    }
+
+    if constexpr (masked_batch<reg>) {
+        if (i < size) {
+            auto const mask = reg::tail_mask(size - i);
+            auto acc        = reg::maskz_loadu(mask, &z[i]);
+            interleaved_complex_multiply_add<reg>(reg::maskz_loadu(mask, &x[i]), reg::maskz_loadu(mask, &y[i]), acc);
+            reg::mask_storeu(&out[i], mask, acc);
+        }
+        return;
+    }
+
+    for (; i < size; i += 2) {
+        auto const xre = x[i];
+        auto const xim = x[i + 1];
+        auto const yre = y[i];
+        auto const yim = y[i + 1];
+
+        out[i]     = (xre * yre - xim * yim) + z[i];
+        out[i + 1] = (xre * yim + xim * yre) + z[i + 1];
+    }
+}
+
+/// acc += x[0] * y[0] + ... + x[rows-1] * y[rows-1] on interleaved complex values, size counts floats
+template<typename Batch>
+auto interleaved_multiply_accumulate_rows(
+    std::complex<typename Batch::float_type> const* const* x,
+    std::complex<typename Batch::float_type> const* const* y,
+    std::size_t rows,
+    typename Batch::float_type* NEO_RESTRICT acc,
+    std::size_t size
+) -> void
+{
+    using reg   = Batch;
+    using vec   = typename Batch::register_type;
+    using Float = typename Batch::float_type;
+
+    static constexpr auto const inc    = reg::size;
+    static constexpr auto const unroll = reg::unroll;
+    static constexpr auto const step   = inc * unroll;
+
+    // std::complex is layout compatible with Float[2]
+    auto const row = [](std::complex<Float> const* ptr) { return reinterpret_cast<Float const*>(ptr); };
+
+    auto i = std::size_t(0);
+
+    for (; i + step <= size; i += step) {
+        vec sum[unroll];
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            sum[u] = reg::loadu(&acc[i + u * inc]);
+        }
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            auto const* xk = row(x[k]);
+            auto const* yk = row(y[k]);
+            for (auto u = std::size_t(0); u < unroll; ++u) {
+                auto const j = i + u * inc;
+                interleaved_complex_multiply_add<reg>(reg::loadu(&xk[j]), reg::loadu(&yk[j]), sum[u]);
+            }
+        }
+        for (auto u = std::size_t(0); u < unroll; ++u) {
+            reg::storeu(&acc[i + u * inc], sum[u]);
+        }
+    }
+
+    for (; i + inc <= size; i += inc) {
+        auto sum = reg::loadu(&acc[i]);
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            interleaved_complex_multiply_add<reg>(reg::loadu(&row(x[k])[i]), reg::loadu(&row(y[k])[i]), sum);
+        }
+        reg::storeu(&acc[i], sum);
+    }
+
+    if constexpr (masked_batch<reg>) {
+        if (i < size) {
+            auto const mask = reg::tail_mask(size - i);
+            auto sum        = reg::maskz_loadu(mask, &acc[i]);
+            for (auto k = std::size_t(0); k < rows; ++k) {
+                interleaved_complex_multiply_add<reg>(
+                    reg::maskz_loadu(mask, &row(x[k])[i]),
+                    reg::maskz_loadu(mask, &row(y[k])[i]),
+                    sum
+                );
+            }
+            reg::mask_storeu(&acc[i], mask, sum);
+        }
+        return;
+    }
+
+    for (; i < size; i += 2) {
+        auto re = acc[i];
+        auto im = acc[i + 1];
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            auto const xre = row(x[k])[i];
+            auto const xim = row(x[k])[i + 1];
+            auto const yre = row(y[k])[i];
+            auto const yim = row(y[k])[i + 1];
+
+            re += xre * yre - xim * yim;
+            im += xre * yim + xim * yre;
+        }
+        acc[i]     = re;
+        acc[i + 1] = im;
+    }
+}
+
 }  // namespace detail
 
 #if defined(NEO_HAS_APPLE_ACCELERATE)
@@ -101,33 +524,181 @@ auto multiply_add(
     }
 }
 
-#elif defined(NEO_HAS_ISA_SSE2) and not defined(NEO_HAS_ISA_AVX)
+#elif defined(NEO_HAS_ISA_AVX512F) and not defined(NEO_COMPILER_MSVC)
     #define NEO_HAS_SIMD_SPLIT_COMPLEX_MULTIPLY_ADD
+    #define NEO_HAS_SIMD_INTERLEAVED_COMPLEX_MULTIPLY_ADD
 
+// 32 registers, four independent chains per loop. Tails use masked loads & stores.
 struct batch_f32
 {
-    using float_type = float;
+    using float_type    = float;
+    using register_type = float32x16::register_type;
+    using mask_type     = __mmask16;
+
+    static constexpr auto const size        = float32x16::size;
+    static constexpr auto const unroll      = std::size_t(4);
+    static constexpr auto const loadu       = _mm512_loadu_ps;
+    static constexpr auto const storeu      = _mm512_storeu_ps;
+    static constexpr auto const maskz_loadu = _mm512_maskz_loadu_ps;
+    static constexpr auto const mask_storeu = _mm512_mask_storeu_ps;
+    static constexpr auto const fmadd       = _mm512_fmadd_ps;
+    static constexpr auto const fnmadd      = _mm512_fnmadd_ps;
+    static constexpr auto const fmaddsub    = _mm512_fmaddsub_ps;
+
+    static constexpr auto const dup_real = _mm512_moveldup_ps;
+    static constexpr auto const dup_imag = _mm512_movehdup_ps;
+    static constexpr auto const swap     = [](register_type v) { return _mm512_permute_ps(v, 0b10'11'00'01); };
+
+    static constexpr auto const tail_mask = [](std::size_t n) { return static_cast<mask_type>((1U << n) - 1U); };
+};
+
+struct batch_f64
+{
+    using float_type    = double;
+    using register_type = float64x8::register_type;
+    using mask_type     = __mmask8;
+
+    static constexpr auto const size        = float64x8::size;
+    static constexpr auto const unroll      = std::size_t(4);
+    static constexpr auto const loadu       = _mm512_loadu_pd;
+    static constexpr auto const storeu      = _mm512_storeu_pd;
+    static constexpr auto const maskz_loadu = _mm512_maskz_loadu_pd;
+    static constexpr auto const mask_storeu = _mm512_mask_storeu_pd;
+    static constexpr auto const fmadd       = _mm512_fmadd_pd;
+    static constexpr auto const fnmadd      = _mm512_fnmadd_pd;
+    static constexpr auto const fmaddsub    = _mm512_fmaddsub_pd;
+
+    static constexpr auto const dup_real = _mm512_movedup_pd;
+    static constexpr auto const dup_imag = [](register_type v) { return _mm512_permute_pd(v, 0xFF); };
+    static constexpr auto const swap     = [](register_type v) { return _mm512_permute_pd(v, 0x55); };
+
+    static constexpr auto const tail_mask = [](std::size_t n) { return static_cast<mask_type>((1U << n) - 1U); };
+};
+
+#elif defined(NEO_HAS_ISA_AVX) and not defined(NEO_COMPILER_MSVC)
+    #define NEO_HAS_SIMD_SPLIT_COMPLEX_MULTIPLY_ADD
+    #define NEO_HAS_SIMD_INTERLEAVED_COMPLEX_MULTIPLY_ADD
+
+struct batch_f32
+{
+    using float_type    = float;
+    using register_type = __m256;
+
+    static constexpr auto const size   = 256 / 32;
+    static constexpr auto const unroll = std::size_t(2);
+    static constexpr auto const loadu  = _mm256_loadu_ps;
+    static constexpr auto const storeu = _mm256_storeu_ps;
+    #if defined(NEO_HAS_ISA_FMA)
+    static constexpr auto const fmadd    = _mm256_fmadd_ps;
+    static constexpr auto const fnmadd   = _mm256_fnmadd_ps;
+    static constexpr auto const fmaddsub = _mm256_fmaddsub_ps;
+    #else
+    static constexpr auto const fmadd  = [](__m256 a, __m256 b, __m256 c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); };
+    static constexpr auto const fnmadd = [](__m256 a, __m256 b, __m256 c) { return _mm256_sub_ps(c, _mm256_mul_ps(a, b)); };
+    static constexpr auto const fmaddsub
+        = [](__m256 a, __m256 b, __m256 c) { return _mm256_addsub_ps(_mm256_mul_ps(a, b), c); };
+    #endif
+
+    static constexpr auto const dup_real = _mm256_moveldup_ps;
+    static constexpr auto const dup_imag = _mm256_movehdup_ps;
+    static constexpr auto const swap     = [](__m256 v) { return _mm256_permute_ps(v, 0b10'11'00'01); };
+};
+
+struct batch_f64
+{
+    using float_type    = double;
+    using register_type = __m256d;
+
+    static constexpr auto const size   = 256 / 64;
+    static constexpr auto const unroll = std::size_t(2);
+    static constexpr auto const loadu  = _mm256_loadu_pd;
+    static constexpr auto const storeu = _mm256_storeu_pd;
+    #if defined(NEO_HAS_ISA_FMA)
+    static constexpr auto const fmadd    = _mm256_fmadd_pd;
+    static constexpr auto const fnmadd   = _mm256_fnmadd_pd;
+    static constexpr auto const fmaddsub = _mm256_fmaddsub_pd;
+    #else
+    static constexpr auto const fmadd = [](__m256d a, __m256d b, __m256d c) {
+        return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+    };
+    static constexpr auto const fnmadd = [](__m256d a, __m256d b, __m256d c) {
+        return _mm256_sub_pd(c, _mm256_mul_pd(a, b));
+    };
+    static constexpr auto const fmaddsub = [](__m256d a, __m256d b, __m256d c) {
+        return _mm256_addsub_pd(_mm256_mul_pd(a, b), c);
+    };
+    #endif
+
+    static constexpr auto const dup_real = _mm256_movedup_pd;
+    static constexpr auto const dup_imag = [](__m256d v) { return _mm256_permute_pd(v, 0b1111); };
+    static constexpr auto const swap     = [](__m256d v) { return _mm256_permute_pd(v, 0b0101); };
+};
+
+#elif defined(NEO_HAS_ISA_SSE2)
+    #define NEO_HAS_SIMD_SPLIT_COMPLEX_MULTIPLY_ADD
+    #if defined(NEO_HAS_ISA_SSE3)
+        #define NEO_HAS_SIMD_INTERLEAVED_COMPLEX_MULTIPLY_ADD
+    #endif
+
+struct batch_f32
+{
+    using float_type    = float;
+    using register_type = __m128;
 
     static constexpr auto const size   = 128 / 32;
+    static constexpr auto const unroll = std::size_t(2);
     static constexpr auto const loadu  = _mm_loadu_ps;
     static constexpr auto const storeu = _mm_storeu_ps;
-    static constexpr auto const add    = _mm_add_ps;
-    static constexpr auto const sub    = _mm_sub_ps;
-    static constexpr auto const mul    = _mm_mul_ps;
+    #if defined(NEO_HAS_ISA_FMA)
+    static constexpr auto const fmadd    = _mm_fmadd_ps;
+    static constexpr auto const fnmadd   = _mm_fnmadd_ps;
+    static constexpr auto const fmaddsub = _mm_fmaddsub_ps;
+    #else
+    static constexpr auto const fmadd  = [](__m128 a, __m128 b, __m128 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); };
+    static constexpr auto const fnmadd = [](__m128 a, __m128 b, __m128 c) { return _mm_sub_ps(c, _mm_mul_ps(a, b)); };
+        #if defined(NEO_HAS_ISA_SSE3)
+    static constexpr auto const fmaddsub = [](__m128 a, __m128 b, __m128 c) { return _mm_addsub_ps(_mm_mul_ps(a, b), c); };
+        #endif
+    #endif
+
+    #if defined(NEO_HAS_ISA_SSE3)
+    static constexpr auto const dup_real = _mm_moveldup_ps;
+    static constexpr auto const dup_imag = _mm_movehdup_ps;
+    static constexpr auto const swap     = [](__m128 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)); };
+    #endif
 };
 
 struct batch_f64
 {
-    using float_type = double;
+    using float_type    = double;
+    using register_type = __m128d;
 
     static constexpr auto const size   = 128 / 64;
+    static constexpr auto const unroll = std::size_t(2);
     static constexpr auto const loadu  = _mm_loadu_pd;
     static constexpr auto const storeu = _mm_storeu_pd;
-    static constexpr auto const add    = _mm_add_pd;
-    static constexpr auto const sub    = _mm_sub_pd;
-    static constexpr auto const mul    = _mm_mul_pd;
+    #if defined(NEO_HAS_ISA_FMA)
+    static constexpr auto const fmadd    = _mm_fmadd_pd;
+    static constexpr auto const fnmadd   = _mm_fnmadd_pd;
+    static constexpr auto const fmaddsub = _mm_fmaddsub_pd;
+    #else
+    static constexpr auto const fmadd  = [](__m128d a, __m128d b, __m128d c) { return _mm_add_pd(_mm_mul_pd(a, b), c); };
+    static constexpr auto const fnmadd = [](__m128d a, __m128d b, __m128d c) { return _mm_sub_pd(c, _mm_mul_pd(a, b)); };
+        #if defined(NEO_HAS_ISA_SSE3)
+    static constexpr auto const fmaddsub = [](__m128d a, __m128d b, __m128d c) { return _mm_addsub_pd(_mm_mul_pd(a, b), c); };
+        #endif
+    #endif
+
+    #if defined(NEO_HAS_ISA_SSE3)
+    static constexpr auto const dup_real = _mm_movedup_pd;
+    static constexpr auto const dup_imag = [](__m128d v) { return _mm_unpackhi_pd(v, v); };
+    static constexpr auto const swap     = [](__m128d v) { return _mm_shuffle_pd(v, v, 0b01); };
+    #endif
 };
 
+#endif
+
+#if defined(NEO_HAS_SIMD_SPLIT_COMPLEX_MULTIPLY_ADD) and not defined(NEO_HAS_APPLE_ACCELERATE)
 template<std::floating_point Float>
     requires(std::same_as<Float, float> or std::same_as<Float, double>)
 auto multiply_add(
@@ -146,54 +717,82 @@ auto multiply_add(
     simd::detail::multiply_add<batch>(x_real, x_imag, y_real, y_imag, z_real, z_imag, out_real, out_imag, size);
 }
 
-#elif defined(NEO_HAS_ISA_AVX) and not defined(NEO_HAS_ISA_AVX512F) and not defined(NEO_COMPILER_MSVC)
-    #define NEO_HAS_SIMD_SPLIT_COMPLEX_MULTIPLY_ADD
-
-struct batch_f32
+/// acc += x * y
+template<std::floating_point Float>
+    requires(std::same_as<Float, float> or std::same_as<Float, double>)
+auto multiply_accumulate(
+    Float const* x_real,
+    Float const* x_imag,
+    Float const* y_real,
+    Float const* y_imag,
+    Float* acc_real,
+    Float* acc_imag,
+    std::size_t size
+) -> void
 {
-    using float_type = float;
-
-    static constexpr auto const size   = 256 / 32;
-    static constexpr auto const loadu  = _mm256_loadu_ps;
-    static constexpr auto const storeu = _mm256_storeu_ps;
-    static constexpr auto const add    = _mm256_add_ps;
-    static constexpr auto const sub    = _mm256_sub_ps;
-    static constexpr auto const mul    = _mm256_mul_ps;
-};
+    using batch = std::conditional_t<std::same_as<Float, float>, batch_f32, batch_f64>;
+    simd::detail::multiply_accumulate<batch>(x_real, x_imag, y_real, y_imag, acc_real, acc_imag, size);
+}
 
-struct batch_f64
+/// acc += x[0] * y[0] + ... + x[rows-1] * y[rows-1]
+template<std::floating_point Float>
+    requires(std::same_as<Float, float> or std::same_as<Float, double>)
+auto multiply_accumulate(
+    Float const* const* x_real,
+    Float const* const* x_imag,
+    Float const* const* y_real,
+    Float const* const* y_imag,
+    std::size_t rows,
+    Float* acc_real,
+    Float* acc_imag,
+    std::size_t size
+) -> void
 {
-    using float_type = double;
-
-    static constexpr auto const size   = 256 / 64;
-    static constexpr auto const loadu  = _mm256_loadu_pd;
-    static constexpr auto const storeu = _mm256_storeu_pd;
-    static constexpr auto const add    = _mm256_add_pd;
-    static constexpr auto const sub    = _mm256_sub_pd;
-    static constexpr auto const mul    = _mm256_mul_pd;
-};
+    using batch = std::conditional_t<std::same_as<Float, float>, batch_f32, batch_f64>;
+    simd::detail::multiply_accumulate_rows<batch>(x_real, x_imag, y_real, y_imag, rows, acc_real, acc_imag, size);
+}
+#endif
 
+#if defined(NEO_HAS_SIMD_INTERLEAVED_COMPLEX_MULTIPLY_ADD)
 template<std::floating_point Float>
     requires(std::same_as<Float, float> or std::same_as<Float, double>)
 auto multiply_add(
-    Float const* x_real,
-    Float const* x_imag,
-    Float const* y_real,
-    Float const* y_imag,
-    Float const* z_real,
-    Float const* z_imag,
-    Float* out_real,
-    Float* out_imag,
+    std::complex<Float> const* x,
+    std::complex<Float> const* y,
+    std::complex<Float> const* z,
+    std::complex<Float>* out,
     std::size_t size
 ) -> void
 {
+    // std::complex is layout compatible with Float[2]
     using batch = std::conditional_t<std::same_as<Float, float>, batch_f32, batch_f64>;
-    simd::detail::multiply_add<batch>(x_real, x_imag, y_real, y_imag, z_real, z_imag, out_real, out_imag, size);
+    simd::detail::interleaved_multiply_add<batch>(
+        reinterpret_cast<Float const*>(x),
+        reinterpret_cast<Float const*>(y),
+        reinterpret_cast<Float const*>(z),
+        reinterpret_cast<Float*>(out),
+        size * 2
+    );
 }
 
+/// acc += x[0] * y[0] + ... + x[rows-1] * y[rows-1]
+template<std::floating_point Float>
+    requires(std::same_as<Float, float> or std::same_as<Float, double>)
+auto multiply_accumulate(
+    std::complex<Float> const* const* x,
+    std::complex<Float> const* const* y,
+    std::size_t rows,
+    std::complex<Float>* acc,
+    std::size_t size
+) -> void
+{
+    using batch = std::conditional_t<std::same_as<Float, float>, batch_f32, batch_f64>;
+    simd::detail::interleaved_multiply_accumulate_rows<batch>(x, y, rows, reinterpret_cast<Float*>(acc), size * 2);
+}
 #endif
 
 #if defined(NEO_HAS_XSIMD)
+    #if not defined(NEO_HAS_SIMD_INTERLEAVED_COMPLEX_MULTIPLY_ADD)
 template<std::floating_point Float>
     requires(not std::same_as<Float, long double>)
 auto multiply_add(
@@ -221,6 +820,7 @@ auto multiply_add(
         out[i] = x[i] * y[i] + z[i];
     }
 }
+    #endif
 
     #if not defined(NEO_HAS_SIMD_SPLIT_COMPLEX_MULTIPLY_ADD)
 template<std::floating_point Float>
@@ -281,7 +881,7 @@ constexpr auto multiply_add(VecX x, VecY y, VecZ z, VecOut out) noexcept -> void
 {
     assert(detail::extents_equal(x, y, z, out));
 
-#if defined(NEO_HAS_XSIMD)
+#if defined(NEO_HAS_XSIMD) or defined(NEO_HAS_SIMD_INTERLEAVED_COMPLEX_MULTIPLY_ADD)
     if constexpr (always_vectorizable<VecX, VecY, VecZ, VecOut>) {
         auto x_ptr   = x.data_handle();
         auto y_ptr   = y.data_handle();
@@ -349,6 +949,14 @@ multiply_add(split_complex<VecX> x, split_complex<VecY> y, split_complex<VecZ> z
         [[maybe_unused]] auto* oim = out.imag.data_handle();
 
 #if defined(NEO_HAS_SIMD_SPLIT_COMPLEX_MULTIPLY_ADD) or defined(NEO_HAS_XSIMD)
+        // Every filter accumulates in-place, that kernel streams one array less
+        if constexpr (requires { simd::multiply_accumulate(xre, xim, yre, yim, ore, oim, size); }) {
+            if (zre == ore and zim == oim) {
+                simd::multiply_accumulate(xre, xim, yre, yim, ore, oim, size);
+                return;
+            }
+        }
+
         if constexpr (requires { simd::multiply_add(xre, xim, yre, yim, zre, zim, ore, oim, size); }) {
             simd::multiply_add(xre, xim, yre, yim, zre, zim, ore, oim, size);
             return;
@@ -367,4 +975,151 @@ multiply_add(split_complex<VecX> x, split_complex<VecY> y, split_complex<VecZ> z
     }
 }
 
+namespace detail {
+
+/// Rows summed per pass by the fused multiply_accumulate.
+inline constexpr auto const multiply_accumulate_rows = std::size_t(8);
+
+}  // namespace detail
+
+/// Fused Multiply-Accumulate \f$acc = acc + \sum_k x_k * y_k\f$
+///
+/// Same result as calling multiply_add(x[k], y[k], acc, acc) for every k, but
+/// the accumulator is only loaded & stored once per tile of bins.
+///
+/// \ingroup neo-linalg
+template<in_vector VecX, in_vector VecY, inout_vector VecAcc>
+constexpr auto multiply_accumulate(std::span<VecX const> x, std::span<VecY const> y, VecAcc acc) noexcept -> void
+{
+    assert(x.size() == y.size());
+
+    using Value = value_type_t<VecAcc>;
+
+    constexpr auto const tile = std::size_t(16);
+
+    auto const size = static_cast<std::size_t>(acc.extent(0));
+    auto const rows = x.size();
+
+#if defined(NEO_HAS_SIMD_INTERLEAVED_COMPLEX_MULTIPLY_ADD)
+    constexpr auto const same_type    = detail::all_same_value_type_v<VecX, VecY, VecAcc>;
+    constexpr auto const vectorizable = same_type and always_vectorizable<VecX, VecY, VecAcc>;
+
+    if constexpr (vectorizable) {
+        auto* out = acc.data_handle();
+
+        if constexpr (requires(Value const* const* p) { simd::multiply_accumulate(p, p, rows, out, size); }) {
+            constexpr auto const max_rows = detail::multiply_accumulate_rows;
+
+            auto xk = std::array<Value const*, max_rows>{};
+            auto yk = std::array<Value const*, max_rows>{};
+
+            for (auto first = std::size_t(0); first < rows; first += max_rows) {
+                auto const count = std::min(max_rows, rows - first);
+                for (auto k = std::size_t(0); k < count; ++k) {
+                    assert(neo::detail::extents_equal(x[first + k], y[first + k], acc));
+                    xk[k] = x[first + k].data_handle();
+                    yk[k] = y[first + k].data_handle();
+                }
+                simd::multiply_accumulate(xk.data(), yk.data(), count, out, size);
+            }
+            return;
+        }
+    }
+#endif
+
+    for (auto first = std::size_t(0); first < size; first += tile) {
+        auto const count = std::min(tile, size - first);
+
+        // Separate real & imag math, std::complex multiplication would block vectorization
+        if constexpr (complex<Value>) {
+            using Float = typename Value::value_type;
+
+            Float re[tile]{};
+            Float im[tile]{};
+            for (auto j = std::size_t(0); j < count; ++j) {
+                re[j] = acc[first + j].real();
+                im[j] = acc[first + j].imag();
+            }
+            for (auto k = std::size_t(0); k < rows; ++k) {
+                assert(neo::detail::extents_equal(x[k], y[k], acc));
+                for (auto j = std::size_t(0); j < count; ++j) {
+                    auto const xv = x[k][first + j];
+                    auto const yv = y[k][first + j];
+                    re[j] += xv.real() * yv.real() - xv.imag() * yv.imag();
+                    im[j] += xv.real() * yv.imag() + xv.imag() * yv.real();
+                }
+            }
+            for (auto j = std::size_t(0); j < count; ++j) {
+                acc[first + j] = Value{re[j], im[j]};
+            }
+        } else {
+            Value sum[tile]{};
+            for (auto j = std::size_t(0); j < count; ++j) {
+                sum[j] = acc[first + j];
+            }
+            for (auto k = std::size_t(0); k < rows; ++k) {
+                assert(neo::detail::extents_equal(x[k], y[k], acc));
+                for (auto j = std::size_t(0); j < count; ++j) {
+                    sum[j] += x[k][first + j] * y[k][first + j];
+                }
+            }
+            for (auto j = std::size_t(0); j < count; ++j) {
+                acc[first + j] = sum[j];
+            }
+        }
+    }
+}
+
+/// Fused Multiply-Accumulate \f$acc = acc + \sum_k x_k * y_k\f$
+/// \ingroup neo-linalg
+template<in_vector VecX, in_vector VecY, inout_vector VecAcc>
+constexpr auto
+multiply_accumulate(std::span<split_complex<VecX> const> x, std::span<split_complex<VecY> const> y, split_complex<VecAcc> acc) noexcept
+    -> void
+{
+    assert(x.size() == y.size());
+
+#if defined(NEO_HAS_SIMD_SPLIT_COMPLEX_MULTIPLY_ADD) and not defined(NEO_HAS_APPLE_ACCELERATE)
+    constexpr auto const same_type    = detail::all_same_value_type_v<VecX, VecY, VecAcc>;
+    constexpr auto const vectorizable = same_type and always_vectorizable<VecX, VecY, VecAcc>;
+
+    if constexpr (vectorizable) {
+        using Float = value_type_t<VecAcc>;
+
+        auto const size = static_cast<std::size_t>(acc.real.extent(0));
+        auto* are       = acc.real.data_handle();
+        auto* aim       = acc.imag.data_handle();
+
+        if constexpr (requires(Float const* const* p) { simd::multiply_accumulate(p, p, p, p, size, are, aim, size); }) {
+            constexpr auto const max_rows = detail::multiply_accumulate_rows;
+
+            auto xre = std::array<Float const*, max_rows>{};
+            auto xim = std::array<Float const*, max_rows>{};
+            auto yre = std::array<Float const*, max_rows>{};
+            auto yim = std::array<Float const*, max_rows>{};
+
+            for (auto first = std::size_t(0); first < x.size(); first += max_rows) {
+                auto const rows = std::min(max_rows, x.size() - first);
+                for (auto k = std::size_t(0); k < rows; ++k) {
+                    auto const& xk = x[first + k];
+                    auto const& yk = y[first + k];
+                    assert(neo::detail::extents_equal(xk.real, xk.imag, yk.real, yk.imag, acc.real, acc.imag));
+
+                    xre[k] = xk.real.data_handle();
+                    xim[k] = xk.imag.data_handle();
+                    yre[k] = yk.real.data_handle();
+                    yim[k] = yk.imag.data_handle();
+                }
+                simd::multiply_accumulate(xre.data(), xim.data(), yre.data(), yim.data(), rows, are, aim, size);
+            }
+            return;
+        }
+    }
+#endif
+
+    for (auto k = std::size_t(0); k < x.size(); ++k) {
+        multiply_add(x[k], y[k], acc, acc);
+    }
+}
+
 }  // namespace neo
@@ -6,11 +6,20 @@
 #include <neo/algorithm/allmatch.hpp>
 #include <neo/algorithm/fill.hpp>
 #include <neo/math/float_equality.hpp>
+#include <neo/testing/testing.hpp>
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 
+#include <complex>
+#include <concepts>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 template<typename Float>
 auto test_csr_matrix()
 {
@@ -93,3 +102,251 @@ TEMPLATE_TEST_CASE("neo/algorithm: multiply_add(split_complex)", "", float, doub
         REQUIRE(out.imag[i] == Catch::Approx(16.0));
     }
 }
+
+TEMPLATE_TEST_CASE("neo/algorithm: multiply_add(split_complex, random)", "", float, double)
+{
+    using Float = TestType;
+
+    // Covers the unrolled loop, the single vector loop and the scalar tail
+    auto const size     = GENERATE(as<std::size_t>{}, 1, 3, 7, 8, 15, 16, 17, 31, 32, 63, 64, 65, 127, 128, 129, 257);
+    auto const in_place = GENERATE(false, true);
+    CAPTURE(size);
+    CAPTURE(in_place);
+
+    auto const make = [size](std::uint32_t seed) {
+        auto buf        = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{2, size};
+        auto const real = neo::generate_noise_signal<Float>(size, seed);
+        auto const imag = neo::generate_noise_signal<Float>(size, seed + 1U);
+        for (auto i = std::size_t(0); i < size; ++i) {
+            buf(0, i) = real(i);
+            buf(1, i) = imag(i);
+        }
+        return buf;
+    };
+    auto const split = [](auto& buf) {
+        return neo::split_complex{
+            stdex::submdspan(buf.to_mdspan(), 0, stdex::full_extent),
+            stdex::submdspan(buf.to_mdspan(), 1, stdex::full_extent),
+        };
+    };
+
+    auto x_buf   = make(1);
+    auto y_buf   = make(3);
+    auto z_buf   = make(5);
+    auto out_buf = in_place ? z_buf : make(7);
+
+    auto const expected = [&] {
+        auto buf = z_buf;
+        for (auto i = std::size_t(0); i < size; ++i) {
+            auto const xre = x_buf(0, i);
+            auto const xim = x_buf(1, i);
+            auto const yre = y_buf(0, i);
+            auto const yim = y_buf(1, i);
+            buf(0, i)      = (xre * yre - xim * yim) + z_buf(0, i);
+            buf(1, i)      = (xre * yim + xim * yre) + z_buf(1, i);
+        }
+        return buf;
+    }();
+
+    auto const x   = split(x_buf);
+    auto const y   = split(y_buf);
+    auto const out = split(out_buf);
+    if (in_place) {
+        neo::multiply_add(x, y, out, out);
+    } else {
+        neo::multiply_add(x, y, split(z_buf), out);
+    }
+
+    for (auto i = std::size_t(0); i < size; ++i) {
+        REQUIRE(out_buf(0, i) == Catch::Approx(expected(0, i)).margin(1e-5));
+        REQUIRE(out_buf(1, i) == Catch::Approx(expected(1, i)).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/algorithm: multiply_add(complex, random)", "", std::complex<float>, std::complex<double>)
+{
+    using Complex = TestType;
+    using Float   = typename Complex::value_type;
+
+    auto const size     = GENERATE(as<std::size_t>{}, 1, 3, 7, 8, 15, 16, 17, 31, 32, 63, 64, 65, 127, 128, 129, 257);
+    auto const in_place = GENERATE(false, true);
+    CAPTURE(size);
+    CAPTURE(in_place);
+
+    // One extra bin behind every vector, the tail must not touch it
+    auto const guard = Complex{Float(42), Float(-42)};
+    auto const make  = [size, guard](std::uint32_t seed) {
+        auto buf = neo::generate_noise_signal<Complex>(size + 1, seed);
+        buf(size) = guard;
+        return buf;
+    };
+    auto const view = [size](auto& buf) { return stdex::submdspan(buf.to_mdspan(), std::tuple{0, size}); };
+
+    auto x_buf   = make(1);
+    auto y_buf   = make(3);
+    auto z_buf   = make(5);
+    auto out_buf = in_place ? z_buf : make(7);
+
+    auto const expected = [&] {
+        auto buf = z_buf;
+        for (auto i = std::size_t(0); i < size; ++i) {
+            auto const xv = x_buf(i);
+            auto const yv = y_buf(i);
+            buf(i)        = Complex{
+                (xv.real() * yv.real() - xv.imag() * yv.imag()) + z_buf(i).real(),
+                (xv.real() * yv.imag() + xv.imag() * yv.real()) + z_buf(i).imag(),
+            };
+        }
+        return buf;
+    }();
+
+    if (in_place) {
+        neo::multiply_add(view(std::as_const(x_buf)), view(std::as_const(y_buf)), view(out_buf), view(out_buf));
+    } else {
+        neo::multiply_add(view(std::as_const(x_buf)), view(std::as_const(y_buf)), view(std::as_const(z_buf)), view(out_buf));
+    }
+
+    for (auto i = std::size_t(0); i < size; ++i) {
+        REQUIRE(out_buf(i).real() == Catch::Approx(expected(i).real()).margin(1e-5));
+        REQUIRE(out_buf(i).imag() == Catch::Approx(expected(i).imag()).margin(1e-5));
+    }
+    REQUIRE(out_buf(size) == guard);
+}
+
+#if defined(NEO_HAS_SIMD_INTERLEAVED_COMPLEX_MULTIPLY_ADD)
+TEMPLATE_TEST_CASE("neo/algorithm: multiply_add(complex, simd)", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+    using Batch   = std::conditional_t<std::same_as<Float, float>, neo::simd::batch_f32, neo::simd::batch_f64>;
+
+    // Every size from empty up to two unrolled steps, each register holds size / 2 complex values
+    static constexpr auto const lanes = Batch::size / 2 * Batch::unroll;
+
+    auto const guard = Complex{Float(42), Float(-42)};
+    auto const x     = neo::generate_noise_signal<Complex>(lanes * 2 + 1, 1U);
+    auto const y     = neo::generate_noise_signal<Complex>(lanes * 2 + 1, 3U);
+    auto const z     = neo::generate_noise_signal<Complex>(lanes * 2 + 1, 5U);
+
+    for (auto size = std::size_t(0); size <= lanes * 2 + 1; ++size) {
+        CAPTURE(size);
+
+        auto out = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>{size + 1};
+        out(size) = guard;
+
+        neo::simd::multiply_add(x.data(), y.data(), z.data(), out.data(), size);
+
+        for (auto i = std::size_t(0); i < size; ++i) {
+            auto const re = (x(i).real() * y(i).real() - x(i).imag() * y(i).imag()) + z(i).real();
+            auto const im = (x(i).real() * y(i).imag() + x(i).imag() * y(i).real()) + z(i).imag();
+            REQUIRE(out(i).real() == Catch::Approx(re).margin(1e-5));
+            REQUIRE(out(i).imag() == Catch::Approx(im).margin(1e-5));
+        }
+        REQUIRE(out(size) == guard);
+    }
+}
+#endif
+
+TEMPLATE_TEST_CASE("neo/algorithm: multiply_accumulate", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    // More than multiply_accumulate_rows rows are summed in several passes
+    auto const rows = GENERATE(as<std::size_t>{}, 1, 2, 7, 8, 9, 19);
+    auto const size = GENERATE(as<std::size_t>{}, 1, 7, 16, 17, 65, 129, 257);
+    CAPTURE(rows);
+    CAPTURE(size);
+
+    auto x_buf = stdex::mdarray<Float, stdex::dextents<size_t, 3>>{2, rows, size};
+    auto y_buf = stdex::mdarray<Float, stdex::dextents<size_t, 3>>{2, rows, size};
+    for (auto k = std::size_t(0); k < rows; ++k) {
+        for (auto part = std::size_t(0); part < 2; ++part) {
+            auto const seed = static_cast<std::uint32_t>(k * 4 + part);
+            auto const x    = neo::generate_noise_signal<Float>(size, seed);
+            auto const y    = neo::generate_noise_signal<Float>(size, seed + 2U);
+            for (auto i = std::size_t(0); i < size; ++i) {
+                x_buf(part, k, i) = x(i);
+                y_buf(part, k, i) = y(i);
+            }
+        }
+    }
+
+    auto const init = neo::generate_noise_signal<Float>(size, 42U);
+
+    auto expected = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>{size};
+    for (auto i = std::size_t(0); i < size; ++i) {
+        expected(i) = Complex{init(i), -init(i)};
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            expected(i) += Complex{x_buf(0, k, i), x_buf(1, k, i)} * Complex{y_buf(0, k, i), y_buf(1, k, i)};
+        }
+    }
+
+    SECTION("split")
+    {
+        using Row = decltype(stdex::submdspan(std::as_const(x_buf).to_mdspan(), 0, 0, stdex::full_extent));
+
+        auto x = std::vector<neo::split_complex<Row>>{};
+        auto y = std::vector<neo::split_complex<Row>>{};
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            auto const xs = std::as_const(x_buf).to_mdspan();
+            auto const ys = std::as_const(y_buf).to_mdspan();
+            x.push_back({stdex::submdspan(xs, 0, k, stdex::full_extent), stdex::submdspan(xs, 1, k, stdex::full_extent)});
+            y.push_back({stdex::submdspan(ys, 0, k, stdex::full_extent), stdex::submdspan(ys, 1, k, stdex::full_extent)});
+        }
+
+        auto acc_buf = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{2, size};
+        for (auto i = std::size_t(0); i < size; ++i) {
+            acc_buf(0, i) = init(i);
+            acc_buf(1, i) = -init(i);
+        }
+        auto const acc = neo::split_complex{
+            stdex::submdspan(acc_buf.to_mdspan(), 0, stdex::full_extent),
+            stdex::submdspan(acc_buf.to_mdspan(), 1, stdex::full_extent),
+        };
+
+        neo::multiply_accumulate(
+            std::span<neo::split_complex<Row> const>{x},
+            std::span<neo::split_complex<Row> const>{y},
+            acc
+        );
+
+        for (auto i = std::size_t(0); i < size; ++i) {
+            REQUIRE(acc_buf(0, i) == Catch::Approx(expected(i).real()).margin(1e-4));
+            REQUIRE(acc_buf(1, i) == Catch::Approx(expected(i).imag()).margin(1e-4));
+        }
+    }
+
+    SECTION("interleaved")
+    {
+        auto x_data = stdex::mdarray<Complex, stdex::dextents<size_t, 2>>{rows, size};
+        auto y_data = stdex::mdarray<Complex, stdex::dextents<size_t, 2>>{rows, size};
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            for (auto i = std::size_t(0); i < size; ++i) {
+                x_data(k, i) = Complex{x_buf(0, k, i), x_buf(1, k, i)};
+                y_data(k, i) = Complex{y_buf(0, k, i), y_buf(1, k, i)};
+            }
+        }
+
+        using Row = decltype(stdex::submdspan(std::as_const(x_data).to_mdspan(), 0, stdex::full_extent));
+
+        auto x = std::vector<Row>{};
+        auto y = std::vector<Row>{};
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            x.push_back(stdex::submdspan(std::as_const(x_data).to_mdspan(), k, stdex::full_extent));
+            y.push_back(stdex::submdspan(std::as_const(y_data).to_mdspan(), k, stdex::full_extent));
+        }
+
+        auto acc = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>{size};
+        for (auto i = std::size_t(0); i < size; ++i) {
+            acc(i) = Complex{init(i), -init(i)};
+        }
+
+        neo::multiply_accumulate(std::span<Row const>{x}, std::span<Row const>{y}, acc.to_mdspan());
+
+        for (auto i = std::size_t(0); i < size; ++i) {
+            REQUIRE(acc(i).real() == Catch::Approx(expected(i).real()).margin(1e-4));
+            REQUIRE(acc(i).imag() == Catch::Approx(expected(i).imag()).margin(1e-4));
+        }
+    }
+}
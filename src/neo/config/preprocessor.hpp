@@ -42,6 +42,10 @@
     #define NEO_HAS_ISA_AVX2
 #endif
 
+#if defined(__FMA__)
+    #define NEO_HAS_ISA_FMA
+#endif
+
 #if defined(__AVX512F__)
     #define NEO_HAS_ISA_AVX512F
 #endif
@@ -9,4 +9,5 @@
 
 #include <neo/container/compressed_accessor.hpp>
 #include <neo/container/csr_matrix.hpp>
+#include <neo/container/csr_matrix_builder.hpp>
 #include <neo/container/mdspan.hpp>
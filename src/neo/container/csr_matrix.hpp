@@ -4,10 +4,14 @@
 
 #include <neo/container/mdspan.hpp>
 
+#include <cassert>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <span>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace neo {
@@ -29,10 +33,24 @@ struct csr_matrix
     csr_matrix() = default;
     csr_matrix(size_type rows, size_type cols);
 
+    /// Takes ownership of already compressed storage, see csr_matrix_builder.
+    csr_matrix(
+        size_type rows,
+        size_type cols,
+        ValueContainer values,
+        IndexContainer column_indices,
+        IndexContainer row_indices
+    );
+
     template<in_matrix InMat, std::predicate<IndexType, IndexType, T> Filter>
         requires std::is_convertible_v<typename InMat::value_type, T>
     csr_matrix(InMat matrix, Filter filter);
 
+    /// Keeps every element with a non-zero entry in the mask.
+    template<in_matrix InMat, in_matrix InMask>
+        requires(std::is_convertible_v<typename InMat::value_type, T> and std::integral<typename InMask::value_type>)
+    csr_matrix(InMat matrix, InMask mask);
+
     [[nodiscard]] auto extent(size_type e) const noexcept -> size_type;
     [[nodiscard]] auto extents() const noexcept -> stdex::dextents<index_type, 2>;
 
@@ -42,6 +60,7 @@ struct csr_matrix
 
     [[nodiscard]] auto operator()(index_type row, index_type col) const -> T;
 
+    /// Shifts every following element, use csr_matrix_builder for more than a few inserts.
     auto insert(index_type row, index_type col, T value) -> void;
 
     [[nodiscard]] auto value_container() const noexcept -> value_container_type const&;
@@ -49,6 +68,10 @@ struct csr_matrix
     [[nodiscard]] auto row_container() const noexcept -> index_container_type const&;
 
 private:
+    template<in_matrix InMat, typename Filter>
+    [[nodiscard]] static auto make_mask(InMat matrix, Filter& filter)
+        -> stdex::mdarray<std::uint8_t, stdex::dextents<size_type, 2>>;
+
     stdex::dextents<index_type, 2> _extents;
     ValueContainer _values;
     IndexContainer _colum_indices;
@@ -61,19 +84,43 @@ csr_matrix<T, IndexType, ValueContainer, IndexContainer>::csr_matrix(size_type r
     , _row_indices(rows + 1UL, 0)
 {}
 
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+csr_matrix<T, IndexType, ValueContainer, IndexContainer>::csr_matrix(
+    size_type rows,
+    size_type cols,
+    ValueContainer values,
+    IndexContainer column_indices,
+    IndexContainer row_indices
+)
+    : _extents{rows, cols}
+    , _values{std::move(values)}
+    , _colum_indices{std::move(column_indices)}
+    , _row_indices{std::move(row_indices)}
+{
+    assert(_values.size() == _colum_indices.size());
+    assert(_row_indices.size() == rows + 1UL);
+    assert(_row_indices.back() == _values.size());
+}
+
 template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
 template<in_matrix InMat, std::predicate<IndexType, IndexType, T> Filter>
     requires std::is_convertible_v<typename InMat::value_type, T>
 csr_matrix<T, IndexType, ValueContainer, IndexContainer>::csr_matrix(InMat matrix, Filter filter)
+    : csr_matrix{matrix, make_mask(matrix, filter).to_mdspan()}
+{}
+
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+template<in_matrix InMat, in_matrix InMask>
+    requires(std::is_convertible_v<typename InMat::value_type, T> and std::integral<typename InMask::value_type>)
+csr_matrix<T, IndexType, ValueContainer, IndexContainer>::csr_matrix(InMat matrix, InMask mask)
     : csr_matrix{matrix.extent(0), matrix.extent(1)}
 {
+    assert(detail::extents_equal(matrix, mask));
+
     auto count = 0UL;
-    for (auto row_idx{0UL}; row_idx < matrix.extent(0); ++row_idx) {
-        auto const row = stdex::submdspan(matrix, row_idx, stdex::full_extent);
-        for (auto col{0UL}; col < matrix.extent(1); ++col) {
-            if (filter(row_idx, col, row(col))) {
-                ++count;
-            }
+    for (auto row{0UL}; row < mask.extent(0); ++row) {
+        for (auto col{0UL}; col < mask.extent(1); ++col) {
+            count += static_cast<unsigned long>(mask(row, col) != 0);
         }
     }
 
@@ -81,13 +128,11 @@ csr_matrix<T, IndexType, ValueContainer, IndexContainer>::csr_matrix(InMat matri
     _colum_indices.resize(count);
 
     auto idx = 0UL;
-    for (auto row_idx{0UL}; row_idx < matrix.extent(0); ++row_idx) {
-        auto const row        = stdex::submdspan(matrix, row_idx, stdex::full_extent);
-        _row_indices[row_idx] = idx;
-
+    for (auto row{0UL}; row < matrix.extent(0); ++row) {
+        _row_indices[row] = idx;
         for (auto col{0UL}; col < matrix.extent(1); ++col) {
-            if (auto const& val = row(col); filter(row_idx, col, val)) {
-                _values[idx]        = val;
+            if (mask(row, col) != 0) {
+                _values[idx]        = matrix(row, col);
                 _colum_indices[idx] = col;
                 ++idx;
             }
@@ -97,6 +142,21 @@ csr_matrix<T, IndexType, ValueContainer, IndexContainer>::csr_matrix(InMat matri
     _row_indices.back() = idx;
 }
 
+template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
+template<in_matrix InMat, typename Filter>
+auto csr_matrix<T, IndexType, ValueContainer, IndexContainer>::make_mask(InMat matrix, Filter& filter)
+    -> stdex::mdarray<std::uint8_t, stdex::dextents<size_type, 2>>
+{
+    // Evaluates the (possibly expensive) filter only once per element
+    auto mask = stdex::mdarray<std::uint8_t, stdex::dextents<size_type, 2>>{matrix.extent(0), matrix.extent(1)};
+    for (auto row{0UL}; row < matrix.extent(0); ++row) {
+        for (auto col{0UL}; col < matrix.extent(1); ++col) {
+            mask(row, col) = static_cast<std::uint8_t>(filter(row, col, matrix(row, col)));
+        }
+    }
+    return mask;
+}
+
 template<typename T, typename IndexType, typename ValueContainer, typename IndexContainer>
 auto csr_matrix<T, IndexType, ValueContainer, IndexContainer>::extent(size_type e) const noexcept -> size_type
 {
@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/container/csr_matrix.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace neo {
+
+/// \brief Collects (row, col, value) triplets and compresses them into a csr_matrix.
+///
+/// Elements can be pushed in any order, duplicates are summed. As long as the
+/// elements arrive in row-major order, e.g. through append_row, finalize is a
+/// single linear pass. Otherwise the triplets are bucketed by row and each row
+/// is sorted by column.
+///
+/// \ingroup neo-container
+template<typename T, typename IndexType = std::size_t>
+struct csr_matrix_builder
+{
+    using value_type  = T;
+    using size_type   = std::size_t;
+    using index_type  = IndexType;
+    using matrix_type = csr_matrix<T, IndexType>;
+
+    csr_matrix_builder(size_type rows, size_type cols);
+
+    [[nodiscard]] auto rows() const noexcept -> size_type;
+    [[nodiscard]] auto columns() const noexcept -> size_type;
+
+    /// Number of pushed elements, including duplicates.
+    [[nodiscard]] auto size() const noexcept -> size_type;
+
+    auto reserve(size_type nnz) -> void;
+
+    auto push_back(index_type row, index_type col, T value) -> void;
+
+    /// Appends the non-zero elements of a row, \p columns must be sorted.
+    auto append_row(index_type row, std::span<index_type const> columns, std::span<T const> values) -> void;
+
+    /// Builds the matrix and leaves the builder empty.
+    [[nodiscard]] auto finalize() -> matrix_type;
+
+private:
+    [[nodiscard]] auto is_after_last(index_type row, index_type col) const noexcept -> bool;
+
+    auto sort() -> void;
+
+    size_type _rows;
+    size_type _cols;
+    bool _sorted{true};
+
+    std::vector<index_type> _row_indices;
+    std::vector<index_type> _column_indices;
+    std::vector<T> _values;
+};
+
+template<typename T, typename IndexType>
+csr_matrix_builder<T, IndexType>::csr_matrix_builder(size_type rows, size_type cols)
+    : _rows{rows}
+    , _cols{cols}
+{}
+
+template<typename T, typename IndexType>
+auto csr_matrix_builder<T, IndexType>::rows() const noexcept -> size_type
+{
+    return _rows;
+}
+
+template<typename T, typename IndexType>
+auto csr_matrix_builder<T, IndexType>::columns() const noexcept -> size_type
+{
+    return _cols;
+}
+
+template<typename T, typename IndexType>
+auto csr_matrix_builder<T, IndexType>::size() const noexcept -> size_type
+{
+    return _values.size();
+}
+
+template<typename T, typename IndexType>
+auto csr_matrix_builder<T, IndexType>::reserve(size_type nnz) -> void
+{
+    _row_indices.reserve(nnz);
+    _column_indices.reserve(nnz);
+    _values.reserve(nnz);
+}
+
+template<typename T, typename IndexType>
+auto csr_matrix_builder<T, IndexType>::push_back(index_type row, index_type col, T value) -> void
+{
+    assert(static_cast<size_type>(row) < _rows);
+    assert(static_cast<size_type>(col) < _cols);
+
+    _sorted = _sorted and is_after_last(row, col);
+    _row_indices.push_back(row);
+    _column_indices.push_back(col);
+    _values.push_back(std::move(value));
+}
+
+template<typename T, typename IndexType>
+auto csr_matrix_builder<T, IndexType>::append_row(
+    index_type row,
+    std::span<index_type const> columns,
+    std::span<T const> values
+) -> void
+{
+    assert(static_cast<size_type>(row) < _rows);
+    assert(columns.size() == values.size());
+    assert(std::is_sorted(columns.begin(), columns.end()));
+
+    if (columns.empty()) {
+        return;
+    }
+
+    _sorted = _sorted and is_after_last(row, columns.front());
+    _row_indices.insert(_row_indices.end(), columns.size(), row);
+    _column_indices.insert(_column_indices.end(), columns.begin(), columns.end());
+    _values.insert(_values.end(), values.begin(), values.end());
+}
+
+template<typename T, typename IndexType>
+auto csr_matrix_builder<T, IndexType>::finalize() -> matrix_type
+{
+    if (not _sorted) {
+        sort();
+    }
+
+    auto values         = std::vector<T>{};
+    auto column_indices = std::vector<index_type>{};
+    auto row_indices    = std::vector<index_type>(_rows + 1UL, index_type(0));
+    values.reserve(_values.size());
+    column_indices.reserve(_values.size());
+
+    // Sorted row-major, so duplicates are neighbours
+    for (auto i = size_type(0); i < _values.size(); ++i) {
+        auto const row = _row_indices[i];
+        auto const col = _column_indices[i];
+        if (i != 0 and row == _row_indices[i - 1] and col == _column_indices[i - 1]) {
+            values.back() += _values[i];
+            continue;
+        }
+
+        values.push_back(std::move(_values[i]));
+        column_indices.push_back(col);
+        ++row_indices[static_cast<size_type>(row) + 1UL];
+    }
+    std::partial_sum(row_indices.begin(), row_indices.end(), row_indices.begin());
+
+    _row_indices.clear();
+    _column_indices.clear();
+    _values.clear();
+    _sorted = true;
+
+    return matrix_type{_rows, _cols, std::move(values), std::move(column_indices), std::move(row_indices)};
+}
+
+template<typename T, typename IndexType>
+auto csr_matrix_builder<T, IndexType>::is_after_last(index_type row, index_type col) const noexcept -> bool
+{
+    if (_values.empty()) {
+        return true;
+    }
+
+    auto const last_row = _row_indices.back();
+    return row > last_row or (row == last_row and col >= _column_indices.back());
+}
+
+template<typename T, typename IndexType>
+auto csr_matrix_builder<T, IndexType>::sort() -> void
+{
+    auto const nnz = _values.size();
+
+    // Counting sort by row keeps the push order within each row
+    auto offsets = std::vector<size_type>(_rows + 1UL, 0);
+    for (auto row : _row_indices) {
+        ++offsets[static_cast<size_type>(row) + 1UL];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    auto order = std::vector<size_type>(nnz);
+    auto next  = offsets;
+    for (auto i = size_type(0); i < nnz; ++i) {
+        order[next[static_cast<size_type>(_row_indices[i])]++] = i;
+    }
+
+    // Stable, so duplicates are summed in push order
+    for (auto row = size_type(0); row < _rows; ++row) {
+        auto const first = std::next(order.begin(), static_cast<std::ptrdiff_t>(offsets[row]));
+        auto const last  = std::next(order.begin(), static_cast<std::ptrdiff_t>(offsets[row + 1]));
+        std::stable_sort(first, last, [this](size_type lhs, size_type rhs) {
+            return _column_indices[lhs] < _column_indices[rhs];
+        });
+    }
+
+    auto row_indices    = std::vector<index_type>(nnz);
+    auto column_indices = std::vector<index_type>(nnz);
+    auto values         = std::vector<T>(nnz);
+    for (auto i = size_type(0); i < nnz; ++i) {
+        row_indices[i]    = _row_indices[order[i]];
+        column_indices[i] = _column_indices[order[i]];
+        values[i]         = std::move(_values[order[i]]);
+    }
+
+    _row_indices    = std::move(row_indices);
+    _column_indices = std::move(column_indices);
+    _values         = std::move(values);
+    _sorted         = true;
+}
+
+}  // namespace neo
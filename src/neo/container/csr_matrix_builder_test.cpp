@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+
+#include "csr_matrix_builder.hpp"
+
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <complex>
+#include <random>
+#include <vector>
+
+TEMPLATE_TEST_CASE("neo/container: csr_matrix_builder", "", float, double, std::complex<float>, std::complex<double>)
+{
+    using Scalar = TestType;
+
+    SECTION("empty")
+    {
+        auto builder      = neo::csr_matrix_builder<Scalar>{4, 8};
+        auto const matrix = builder.finalize();
+        REQUIRE(matrix.rows() == 4);
+        REQUIRE(matrix.columns() == 8);
+        REQUIRE(matrix.value_container().empty());
+        REQUIRE(matrix.row_container() == std::vector<std::size_t>(5, 0));
+    }
+
+    SECTION("append_row")
+    {
+        auto builder = neo::csr_matrix_builder<Scalar>{4, 8};
+        builder.reserve(5);
+
+        auto const cols0   = std::vector<std::size_t>{1, 3};
+        auto const values0 = std::vector<Scalar>{Scalar(1), Scalar(2)};
+        auto const cols2   = std::vector<std::size_t>{0, 5, 7};
+        auto const values2 = std::vector<Scalar>{Scalar(3), Scalar(4), Scalar(5)};
+        builder.append_row(0, cols0, values0);
+        builder.append_row(1, {}, {});
+        builder.append_row(2, cols2, values2);
+        REQUIRE(builder.size() == 5);
+
+        auto const matrix = builder.finalize();
+        REQUIRE(builder.size() == 0);
+        REQUIRE(matrix.value_container() == std::vector<Scalar>{Scalar(1), Scalar(2), Scalar(3), Scalar(4), Scalar(5)});
+        REQUIRE(matrix.column_container() == std::vector<std::size_t>{1, 3, 0, 5, 7});
+        REQUIRE(matrix.row_container() == std::vector<std::size_t>{0, 2, 2, 5, 5});
+        REQUIRE(matrix(2, 5) == Scalar(4));
+        REQUIRE(matrix(3, 5) == Scalar(0));
+    }
+
+    SECTION("duplicates")
+    {
+        auto builder = neo::csr_matrix_builder<Scalar>{2, 2};
+        builder.push_back(1, 1, Scalar(1));
+        builder.push_back(0, 0, Scalar(2));
+        builder.push_back(1, 1, Scalar(3));
+        builder.push_back(0, 0, Scalar(4));
+
+        auto const matrix = builder.finalize();
+        REQUIRE(matrix.value_container().size() == 2);
+        REQUIRE(matrix(0, 0) == Scalar(6));
+        REQUIRE(matrix(1, 1) == Scalar(4));
+    }
+
+    SECTION("random order")
+    {
+        auto dense = stdex::mdarray<Scalar, stdex::dextents<std::size_t, 2>>{17, 33};
+        auto coo   = std::vector<std::pair<std::size_t, std::size_t>>{};
+        for (auto row{0UL}; row < dense.extent(0); ++row) {
+            for (auto col{0UL}; col < dense.extent(1); ++col) {
+                if ((row * 7 + col * 3) % 5 == 0) {
+                    dense(row, col) = Scalar(static_cast<float>(row * dense.extent(1) + col + 1));
+                    coo.emplace_back(row, col);
+                }
+            }
+        }
+
+        auto rng = std::mt19937{Catch::getSeed()};
+        std::shuffle(coo.begin(), coo.end(), rng);
+
+        auto builder = neo::csr_matrix_builder<Scalar>{dense.extent(0), dense.extent(1)};
+        builder.reserve(coo.size());
+        for (auto [row, col] : coo) {
+            builder.push_back(row, col, dense(row, col));
+        }
+
+        auto const matrix   = builder.finalize();
+        auto const expected = neo::csr_matrix<Scalar>{
+            dense.to_mdspan(),
+            [](auto row, auto col, auto) { return (row * 7 + col * 3) % 5 == 0; },
+        };
+        REQUIRE(matrix.value_container() == expected.value_container());
+        REQUIRE(matrix.column_container() == expected.column_container());
+        REQUIRE(matrix.row_container() == expected.row_container());
+    }
+}
@@ -61,3 +61,43 @@ TEMPLATE_TEST_CASE("neo/container: csr_matrix", "", float, double, std::complex<
     REQUIRE(sparse.size() == dense.size());
     REQUIRE(sparse.value_container().size() == 0);
 }
+
+TEMPLATE_TEST_CASE("neo/container: csr_matrix(mask)", "", float, double, std::complex<float>, std::complex<double>)
+{
+    using Scalar = TestType;
+    using Float  = neo::real_or_complex_value_t<Scalar>;
+
+    auto dense = stdex::mdarray<Scalar, stdex::dextents<std::size_t, 2>>{16, 32};
+    auto mask  = stdex::mdarray<std::uint8_t, stdex::dextents<std::size_t, 2>>{16, 32};
+    for (auto row{0UL}; row < dense.extent(0); ++row) {
+        for (auto col{0UL}; col < dense.extent(1); ++col) {
+            dense(row, col) = Scalar(Float(row * dense.extent(1) + col + 1));
+            mask(row, col)  = static_cast<std::uint8_t>((row + col) % 3 == 0);
+        }
+    }
+
+    auto const sparse = neo::csr_matrix<Scalar>{dense.to_mdspan(), mask.to_mdspan()};
+    REQUIRE(sparse.extents() == dense.extents());
+
+    auto nnz = 0UL;
+    for (auto row{0UL}; row < dense.extent(0); ++row) {
+        for (auto col{0UL}; col < dense.extent(1); ++col) {
+            if (mask(row, col) != 0) {
+                REQUIRE(sparse(row, col) == dense(row, col));
+                ++nnz;
+            } else {
+                REQUIRE(sparse(row, col) == Scalar(0));
+            }
+        }
+    }
+    REQUIRE(sparse.value_container().size() == nnz);
+
+    // Same result as the predicate
+    auto const predicate = neo::csr_matrix<Scalar>{
+        dense.to_mdspan(),
+        [](auto row, auto col, auto) { return (row + col) % 3 == 0; },
+    };
+    REQUIRE(predicate.value_container() == sparse.value_container());
+    REQUIRE(predicate.column_container() == sparse.column_container());
+    REQUIRE(predicate.row_container() == sparse.row_container());
+}
@@ -163,6 +163,10 @@ template<auto Stride>
 template<in_object First, in_object... Objs>
 inline constexpr auto all_same_value_type_v = (std::same_as<value_type_t<First>, value_type_t<Objs>> and ...);
 
+/// Named, so overloads for specific value types can subsume it.
+template<typename First, typename... Objs>
+concept all_same_rank = ((First::rank() == Objs::rank()) and ...);
+
 }  // namespace detail
 
 /// \ingroup neo-container
@@ -182,6 +186,12 @@ inline constexpr auto has_layout_right = (std::same_as<typename Objs::layout_typ
 template<typename... Objs>
 inline constexpr auto has_layout_left_or_right = has_layout_left<Objs...> or has_layout_right<Objs...>;
 
+/// \brief All elements are stored back-to-back in the same order, so the objects can be processed as flat arrays.
+/// \ingroup neo-container
+template<typename... Objs>
+concept always_contiguous
+    = (in_object<Objs> and ...) and has_default_accessor<Objs...> and has_layout_left_or_right<Objs...>;
+
 /// \ingroup neo-container
 template<typename... Objs>
 concept always_vectorizable
@@ -7,6 +7,9 @@
 /// \defgroup neo-convolution Convolution
 /// Convolution functions
 
+#include <neo/convolution/block_float_convolver.hpp>
+#include <neo/convolution/block_float_fdl.hpp>
+#include <neo/convolution/block_float_filter.hpp>
 #include <neo/convolution/compressed_fdl.hpp>
 #include <neo/convolution/dense_convolver.hpp>
 #include <neo/convolution/dense_fdl.hpp>
@@ -14,6 +17,9 @@
 #include <neo/convolution/direct_convolve.hpp>
 #include <neo/convolution/fdl_index.hpp>
 #include <neo/convolution/fft_convolver.hpp>
+#include <neo/convolution/ifft_scaling.hpp>
+#include <neo/convolution/lod_filter.hpp>
+#include <neo/convolution/masking_threshold.hpp>
 #include <neo/convolution/method.hpp>
 #include <neo/convolution/mode.hpp>
 #include <neo/convolution/normalize_impulse.hpp>
@@ -21,5 +27,7 @@
 #include <neo/convolution/overlap_save.hpp>
 #include <neo/convolution/sparse_convolver.hpp>
 #include <neo/convolution/sparse_filter.hpp>
+#include <neo/convolution/sparsity_budget.hpp>
+#include <neo/convolution/sparsity_mask.hpp>
 #include <neo/convolution/uniform_partition.hpp>
 #include <neo/convolution/uniform_partitioned_convolver.hpp>
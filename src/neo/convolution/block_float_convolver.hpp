@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/complex.hpp>
+#include <neo/convolution/block_float_fdl.hpp>
+#include <neo/convolution/block_float_filter.hpp>
+#include <neo/convolution/overlap_add.hpp>
+#include <neo/convolution/overlap_save.hpp>
+#include <neo/convolution/uniform_partitioned_convolver.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+namespace neo::convolution {
+
+/// \brief FDL & filter are stored as q15 complex with one exponent per partition.
+/// \ingroup neo-convolution
+template<complex Complex>
+using block_float_upols_convolver = uniform_partitioned_convolver<
+    split_overlap_save<Complex>,
+    block_float_fdl<value_type_t<Complex>>,
+    block_float_filter<value_type_t<Complex>>>;
+
+/// \brief FDL & filter are stored as q15 complex with one exponent per partition.
+/// \ingroup neo-convolution
+template<complex Complex>
+using block_float_upola_convolver = uniform_partitioned_convolver<
+    split_overlap_add<Complex>,
+    block_float_fdl<value_type_t<Complex>>,
+    block_float_filter<value_type_t<Complex>>>;
+
+}  // namespace neo::convolution
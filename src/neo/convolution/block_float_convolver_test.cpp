@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: MIT
+
+#include "block_float_convolver.hpp"
+
+#include <neo/algorithm/allclose.hpp>
+#include <neo/convolution/dense_convolver.hpp>
+#include <neo/testing/convolution.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <cmath>
+#include <complex>
+#include <tuple>
+
+namespace {
+
+auto snr_db(neo::in_vector auto reference, neo::in_vector auto test) -> double
+{
+    auto signal = 0.0;
+    auto noise  = 0.0;
+    for (auto i = std::size_t(0); i < reference.extent(0); ++i) {
+        auto const ref   = static_cast<double>(reference[i]);
+        auto const error = static_cast<double>(test[i]) - ref;
+        signal += ref * ref;
+        noise += error * error;
+    }
+    return 10.0 * std::log10(signal / noise);
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/convolution: block_float_fdl", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto input = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{8};
+    input(0)   = Complex{Float(+0.000), Float(+0.125)};
+    input(1)   = Complex{Float(+2.500), Float(-3.000)};
+    input(2)   = Complex{Float(-5.000), Float(+0.001)};
+    input(3)   = Complex{Float(+1.000), Float(+4.999)};
+
+    auto fdl = neo::convolution::block_float_fdl<Float>{stdex::dextents<std::size_t, 2>{2, 8}};
+    REQUIRE(fdl[0].exponent == neo::convolution::block_float_row::silent);
+    REQUIRE(fdl.is_silent(0));
+
+    fdl.insert(input.to_mdspan(), 0);
+    REQUIRE_FALSE(fdl.is_silent(0));
+    auto const row = fdl[0];
+    REQUIRE(row.mantissa.extent(0) == 8);
+    REQUIRE(row.exponent == 3);
+
+    auto const dequantize = [exponent = row.exponent](neo::q15 val) {
+        return std::ldexp(static_cast<double>(neo::to_float(val)), exponent);
+    };
+
+    // Every bin has the same absolute error, set by the largest one
+    auto const tolerance = std::ldexp(1.0, 3 - 15);
+    for (auto i = std::size_t(0); i < input.extent(0); ++i) {
+        CAPTURE(i);
+        REQUIRE(dequantize(row.mantissa[i].real()) == Catch::Approx(input(i).real()).margin(tolerance));
+        REQUIRE(dequantize(row.mantissa[i].imag()) == Catch::Approx(input(i).imag()).margin(tolerance));
+    }
+
+    auto split = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{2, 8};
+    for (auto i = std::size_t(0); i < input.extent(0); ++i) {
+        split(0, i) = input(i).real();
+        split(1, i) = input(i).imag();
+    }
+
+    fdl.insert(
+        neo::split_complex{
+            stdex::submdspan(split.to_mdspan(), 0, stdex::full_extent),
+            stdex::submdspan(split.to_mdspan(), 1, stdex::full_extent),
+        },
+        1
+    );
+    REQUIRE(fdl[1].exponent == row.exponent);
+    for (auto i = std::size_t(0); i < input.extent(0); ++i) {
+        REQUIRE(fdl[1].mantissa[i].real() == row.mantissa[i].real());
+        REQUIRE(fdl[1].mantissa[i].imag() == row.mantissa[i].imag());
+    }
+
+    // Silence is flagged, so the filter can skip it
+    fdl.insert(stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{8}.to_mdspan(), 0);
+    REQUIRE(fdl[0].exponent == neo::convolution::block_float_row::silent);
+    REQUIRE(fdl.is_silent(0));
+    REQUIRE_FALSE(fdl.is_silent(1));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/convolution: block_float_convolver",
+    "",
+    (neo::convolution::block_float_upols_convolver, neo::convolution::block_float_upola_convolver),
+    (std::complex<float>, std::complex<double>)
+)
+{
+    using Convolver = TestType;
+    using Complex   = typename Convolver::value_type;
+    using Float     = typename Complex::value_type;
+
+    auto const block_size     = GENERATE(as<std::size_t>{}, 64, 256);
+    auto const num_partitions = GENERATE(as<std::size_t>{}, 1, 9, 24);
+    CAPTURE(block_size);
+    CAPTURE(num_partitions);
+
+    // Exponential decay over 60 dB, so the partitions end up with different exponents
+    auto impulse = neo::generate_noise_signal<Float>(block_size * num_partitions, Catch::getSeed());
+    for (auto i = std::size_t(0); i < impulse.extent(0); ++i) {
+        auto const t = static_cast<double>(i) / static_cast<double>(impulse.extent(0));
+        impulse(i) *= static_cast<Float>(std::pow(10.0, -3.0 * t));
+    }
+
+    auto const filter  = neo::partition_impulse(impulse.to_mdspan(), block_size);
+    auto const channel = filter.to_mdspan();
+
+    auto reference = neo::convolution::split_upols_convolver<Complex>{};
+    auto convolver = Convolver{};
+    reference.filter(channel);
+    convolver.filter(channel);
+
+    // The input goes silent halfway, the tail is still rendered through the quantized FDL
+    auto const num_blocks = num_partitions * 2 + 8;
+    auto signal           = neo::generate_noise_signal<Float>(block_size * num_blocks, Catch::getSeed() + 1U);
+    for (auto i = signal.extent(0) / 2; i < signal.extent(0); ++i) {
+        signal(i) = Float(0);
+    }
+
+    auto expected = signal;
+    auto output   = signal;
+    for (auto i = std::size_t(0); i < signal.extent(0); i += block_size) {
+        reference(stdex::submdspan(expected.to_mdspan(), std::tuple{i, i + block_size}));
+        convolver(stdex::submdspan(output.to_mdspan(), std::tuple{i, i + block_size}));
+    }
+
+    REQUIRE(snr_db(expected.to_mdspan(), output.to_mdspan()) > 75.0);
+}
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/convolution: block_float_convolver(identity)",
+    "",
+    (neo::convolution::block_float_upols_convolver, neo::convolution::block_float_upola_convolver),
+    (std::complex<float>, std::complex<double>)
+)
+{
+    using Convolver = TestType;
+    using Complex   = typename Convolver::value_type;
+    using Float     = typename Complex::value_type;
+
+    auto const block_size = GENERATE(as<std::size_t>{}, 128, 512);
+    CAPTURE(block_size);
+
+    auto const filter = neo::generate_identity_impulse<Float>(block_size, 3);
+    auto const signal = neo::generate_noise_signal<Float>(block_size * 20UL, Catch::getSeed());
+    auto output       = signal;
+
+    auto convolver = Convolver{};
+    convolver.filter(filter.to_mdspan());
+
+    for (auto i = std::size_t(0); i < output.extent(0); i += block_size) {
+        convolver(stdex::submdspan(output.to_mdspan(), std::tuple{i, i + block_size}));
+    }
+
+    REQUIRE(neo::allclose(output.to_mdspan(), signal.to_mdspan(), Float(1e-3)));
+}
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/algorithm/fill.hpp>
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fixed_point/complex.hpp>
+#include <neo/fixed_point/fixed_point.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+namespace neo::convolution {
+
+/// \brief Row of a block-floating-point spectrum, each bin is mantissa * 2^exponent.
+/// \ingroup neo-convolution
+struct block_float_row
+{
+    /// Exponent of a row that is all zero, products with it are skipped.
+    static constexpr auto const silent = std::numeric_limits<int>::min() / 4;
+
+    stdex::mdspan<complex_q15 const, stdex::dextents<size_t, 1>> mantissa;
+    int exponent{silent};
+};
+
+namespace detail {
+
+/// \brief Scales the row so its largest component uses the full q15 range, returns the exponent.
+///
+/// The mantissas are clamped to +-32767, so negating one never overflows.
+template<typename Real, typename Imag>
+auto quantize_block_float(Real real, Imag imag, stdex::mdspan<complex_q15, stdex::dextents<size_t, 1>> out) -> int
+{
+    using Float = decltype(real(size_t{}));
+
+    auto peak = Float(0);
+    for (auto i = size_t(0); i < out.extent(0); ++i) {
+        peak = std::max(peak, std::max(std::abs(real(i)), std::abs(imag(i))));
+    }
+
+    if (peak == Float(0)) {
+        fill(out, complex_q15{});
+        return block_float_row::silent;
+    }
+
+    auto exponent = 0;
+    std::frexp(peak, &exponent);
+
+    auto const scale    = static_cast<Float>(std::ldexp(1.0, 15 - exponent));
+    auto const quantize = [scale](Float val) {
+        auto const q = std::nearbyint(std::clamp(val * scale, Float(-32767), Float(32767)));
+        return q15{underlying_value, static_cast<std::int16_t>(q)};
+    };
+
+    for (auto i = size_t(0); i < out.extent(0); ++i) {
+        out[i] = complex_q15{quantize(real(i)), quantize(imag(i))};
+    }
+    return exponent;
+}
+
+}  // namespace detail
+
+/// \brief Frequency-domain delay line of q15 complex rows, with one exponent per row.
+///
+/// Halves the memory of a float FDL. See block_float_filter.
+///
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+struct block_float_fdl
+{
+    using value_type      = std::complex<Float>;
+    using compressed_type = complex_q15;
+
+    block_float_fdl() = default;
+
+    explicit block_float_fdl(stdex::dextents<size_t, 2> extents);
+
+    [[nodiscard]] auto operator[](std::integral auto index) const noexcept -> block_float_row;
+
+    /// True if the row is all zero, products with it can be skipped.
+    [[nodiscard]] auto is_silent(std::integral auto index) const noexcept -> bool;
+
+    auto insert(in_vector auto input, std::integral auto index) noexcept -> void;
+
+    template<in_vector InVec>
+    auto insert(split_complex<InVec> input, std::integral auto index) noexcept -> void;
+
+private:
+    stdex::mdarray<complex_q15, stdex::dextents<size_t, 2>> _fdl{};
+    stdex::mdarray<int, stdex::dextents<size_t, 1>> _exponents{};
+};
+
+template<std::floating_point Float>
+block_float_fdl<Float>::block_float_fdl(stdex::dextents<size_t, 2> extents)
+    : _fdl{extents}
+    , _exponents{extents.extent(0)}
+{
+    fill(_exponents.to_mdspan(), block_float_row::silent);
+}
+
+template<std::floating_point Float>
+auto block_float_fdl<Float>::operator[](std::integral auto index) const noexcept -> block_float_row
+{
+    return {
+        .mantissa = stdex::submdspan(_fdl.to_mdspan(), index, stdex::full_extent),
+        .exponent = _exponents(index),
+    };
+}
+
+template<std::floating_point Float>
+auto block_float_fdl<Float>::is_silent(std::integral auto index) const noexcept -> bool
+{
+    return _exponents(index) == block_float_row::silent;
+}
+
+template<std::floating_point Float>
+auto block_float_fdl<Float>::insert(in_vector auto input, std::integral auto index) noexcept -> void
+{
+    _exponents(index) = detail::quantize_block_float(
+        [input](size_t i) { return static_cast<Float>(input[i].real()); },
+        [input](size_t i) { return static_cast<Float>(input[i].imag()); },
+        stdex::submdspan(_fdl.to_mdspan(), index, stdex::full_extent)
+    );
+}
+
+template<std::floating_point Float>
+template<in_vector InVec>
+auto block_float_fdl<Float>::insert(split_complex<InVec> input, std::integral auto index) noexcept -> void
+{
+    _exponents(index) = detail::quantize_block_float(
+        [input](size_t i) { return static_cast<Float>(input.real[i]); },
+        [input](size_t i) { return static_cast<Float>(input.imag[i]); },
+        stdex::submdspan(_fdl.to_mdspan(), index, stdex::full_extent)
+    );
+}
+
+}  // namespace neo::convolution
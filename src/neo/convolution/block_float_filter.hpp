@@ -0,0 +1,332 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/convolution/block_float_fdl.hpp>
+#include <neo/convolution/fdl_index.hpp>
+#include <neo/fixed_point/complex.hpp>
+#include <neo/simd/native.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+namespace neo::convolution {
+
+namespace detail {
+
+/// Headroom of the 32-bit sums, enough for 16 full-scale products.
+inline constexpr auto const block_float_headroom = 4;
+
+#if defined(NEO_HAS_ISA_AVX512BW)
+    #define NEO_HAS_SIMD_BLOCK_FLOAT_MULTIPLY_ACCUMULATE
+
+struct block_float_batch
+{
+    static constexpr auto const size = std::size_t(16);
+
+    NEO_ALWAYS_INLINE static auto load(complex_q15 const* ptr) noexcept -> __m512i { return _mm512_loadu_si512(ptr); }
+
+    // (re, im) -> (re, -im)
+    NEO_ALWAYS_INLINE static auto conj(__m512i v) noexcept -> __m512i
+    {
+        return _mm512_mask_sub_epi16(v, 0xAAAAAAAA, _mm512_setzero_si512(), v);
+    }
+
+    // (re, im) -> (im, re)
+    NEO_ALWAYS_INLINE static auto swap(__m512i v) noexcept -> __m512i { return _mm512_rol_epi32(v, 16); }
+
+    NEO_ALWAYS_INLINE static auto dot(__m512i x, __m512i y) noexcept -> __m512i { return _mm512_madd_epi16(x, y); }
+
+    NEO_ALWAYS_INLINE static auto accumulate(__m512i acc, __m512i v, int shift) noexcept -> __m512i
+    {
+        return _mm512_add_epi32(acc, _mm512_sra_epi32(v, _mm_cvtsi32_si128(shift)));
+    }
+
+    NEO_ALWAYS_INLINE static auto zero() noexcept -> __m512i { return _mm512_setzero_si512(); }
+
+    NEO_ALWAYS_INLINE static auto scale_add(__m512i v, float scale, float* out) noexcept -> void
+    {
+        _mm512_storeu_ps(out, _mm512_fmadd_ps(_mm512_cvtepi32_ps(v), _mm512_set1_ps(scale), _mm512_loadu_ps(out)));
+    }
+};
+
+#elif defined(NEO_HAS_ISA_AVX2)
+    #define NEO_HAS_SIMD_BLOCK_FLOAT_MULTIPLY_ACCUMULATE
+
+struct block_float_batch
+{
+    static constexpr auto const size = std::size_t(8);
+
+    NEO_ALWAYS_INLINE static auto load(complex_q15 const* ptr) noexcept -> __m256i
+    {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr));
+    }
+
+    // (re, im) -> (re, -im)
+    NEO_ALWAYS_INLINE static auto conj(__m256i v) noexcept -> __m256i
+    {
+        return _mm256_sign_epi16(v, _mm256_set1_epi32(static_cast<int>(0xFFFF0001U)));
+    }
+
+    // (re, im) -> (im, re)
+    NEO_ALWAYS_INLINE static auto swap(__m256i v) noexcept -> __m256i
+    {
+        return _mm256_or_si256(_mm256_slli_epi32(v, 16), _mm256_srli_epi32(v, 16));
+    }
+
+    NEO_ALWAYS_INLINE static auto dot(__m256i x, __m256i y) noexcept -> __m256i { return _mm256_madd_epi16(x, y); }
+
+    NEO_ALWAYS_INLINE static auto accumulate(__m256i acc, __m256i v, int shift) noexcept -> __m256i
+    {
+        return _mm256_add_epi32(acc, _mm256_sra_epi32(v, _mm_cvtsi32_si128(shift)));
+    }
+
+    NEO_ALWAYS_INLINE static auto zero() noexcept -> __m256i { return _mm256_setzero_si256(); }
+
+    NEO_ALWAYS_INLINE static auto scale_add(__m256i v, float scale, float* out) noexcept -> void
+    {
+        auto const scaled = _mm256_mul_ps(_mm256_cvtepi32_ps(v), _mm256_set1_ps(scale));
+        _mm256_storeu_ps(out, _mm256_add_ps(scaled, _mm256_loadu_ps(out)));
+    }
+};
+
+#elif defined(NEO_HAS_ISA_SSE41)
+    #define NEO_HAS_SIMD_BLOCK_FLOAT_MULTIPLY_ACCUMULATE
+
+struct block_float_batch
+{
+    static constexpr auto const size = std::size_t(4);
+
+    NEO_ALWAYS_INLINE static auto load(complex_q15 const* ptr) noexcept -> __m128i
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr));
+    }
+
+    // (re, im) -> (re, -im)
+    NEO_ALWAYS_INLINE static auto conj(__m128i v) noexcept -> __m128i
+    {
+        return _mm_sign_epi16(v, _mm_set1_epi32(static_cast<int>(0xFFFF0001U)));
+    }
+
+    // (re, im) -> (im, re)
+    NEO_ALWAYS_INLINE static auto swap(__m128i v) noexcept -> __m128i
+    {
+        return _mm_or_si128(_mm_slli_epi32(v, 16), _mm_srli_epi32(v, 16));
+    }
+
+    NEO_ALWAYS_INLINE static auto dot(__m128i x, __m128i y) noexcept -> __m128i { return _mm_madd_epi16(x, y); }
+
+    NEO_ALWAYS_INLINE static auto accumulate(__m128i acc, __m128i v, int shift) noexcept -> __m128i
+    {
+        return _mm_add_epi32(acc, _mm_sra_epi32(v, _mm_cvtsi32_si128(shift)));
+    }
+
+    NEO_ALWAYS_INLINE static auto zero() noexcept -> __m128i { return _mm_setzero_si128(); }
+
+    NEO_ALWAYS_INLINE static auto scale_add(__m128i v, float scale, float* out) noexcept -> void
+    {
+        auto const scaled = _mm_mul_ps(_mm_cvtepi32_ps(v), _mm_set1_ps(scale));
+        _mm_storeu_ps(out, _mm_add_ps(scaled, _mm_loadu_ps(out)));
+    }
+};
+
+#endif
+
+/// \brief acc += scale * sum((x[k] * y[k]) >> shifts[k])
+///
+/// The complex products of the q15 mantissas are exact in 32 bit. Aligning
+/// them to the largest exponent of the batch keeps the sum in integers, it is
+/// converted to float once per bin.
+template<std::floating_point Float>
+auto multiply_accumulate_block_float(
+    complex_q15 const* const* x,
+    complex_q15 const* const* y,
+    int const* shifts,
+    std::size_t rows,
+    Float scale,
+    Float* NEO_RESTRICT acc_real,
+    Float* NEO_RESTRICT acc_imag,
+    std::size_t size
+) -> void
+{
+    auto i = std::size_t(0);
+
+#if defined(NEO_HAS_SIMD_BLOCK_FLOAT_MULTIPLY_ACCUMULATE)
+    if constexpr (std::same_as<Float, float>) {
+        using batch = block_float_batch;
+
+        for (; i + batch::size <= size; i += batch::size) {
+            auto re = batch::zero();
+            auto im = batch::zero();
+            for (auto k = std::size_t(0); k < rows; ++k) {
+                auto const xv = batch::load(&x[k][i]);
+                auto const yv = batch::load(&y[k][i]);
+                re            = batch::accumulate(re, batch::dot(xv, batch::conj(yv)), shifts[k]);
+                im            = batch::accumulate(im, batch::dot(xv, batch::swap(yv)), shifts[k]);
+            }
+            batch::scale_add(re, scale, &acc_real[i]);
+            batch::scale_add(im, scale, &acc_imag[i]);
+        }
+    }
+#endif
+
+    for (; i < size; ++i) {
+        auto re = std::int32_t(0);
+        auto im = std::int32_t(0);
+        for (auto k = std::size_t(0); k < rows; ++k) {
+            auto const xre = std::int32_t(x[k][i].real().value());
+            auto const xim = std::int32_t(x[k][i].imag().value());
+            auto const yre = std::int32_t(y[k][i].real().value());
+            auto const yim = std::int32_t(y[k][i].imag().value());
+
+            re += (xre * yre - xim * yim) >> shifts[k];
+            im += (xre * yim + xim * yre) >> shifts[k];
+        }
+        acc_real[i] += static_cast<Float>(re) * scale;
+        acc_imag[i] += static_cast<Float>(im) * scale;
+    }
+}
+
+}  // namespace detail
+
+/// \brief Block-floating-point filter, q15 complex mantissas with one exponent per partition.
+///
+/// Reads half the bytes of dense_split_filter per bin. Products whose
+/// exponent is more than 31 bits below the largest one of a batch are dropped.
+///
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+struct block_float_filter
+{
+    using value_type       = std::complex<Float>;
+    using accumulator_type = stdex::mdarray<Float, stdex::extents<size_t, 2, std::dynamic_extent>>;
+
+    block_float_filter() = default;
+
+    template<in_matrix Filter>
+        requires complex<value_type_t<Filter>>
+    auto filter(Filter filter) -> void;
+
+    [[nodiscard]] auto operator[](std::integral auto index) const noexcept -> block_float_row;
+
+    template<std::integral Index, inout_matrix_of<Float> Accumulator>
+    auto operator()(block_float_row fdl, Index filter_index, Accumulator accumulator) -> void;
+
+    /// Sums a batch of segments into the accumulator in one pass, see fdl_index::batched.
+    template<std::integral Index, inout_matrix_of<Float> Accumulator>
+    auto operator()(std::span<block_float_row const> fdl, std::span<Index const> filter_indices, Accumulator accumulator)
+        -> void;
+
+private:
+    static constexpr auto const max_batch_size = static_cast<std::size_t>(fdl_index<>::batch_size);
+    static_assert(max_batch_size <= (std::size_t(1) << detail::block_float_headroom));
+
+    stdex::mdarray<complex_q15, stdex::dextents<size_t, 2>> _filter;
+    stdex::mdarray<int, stdex::dextents<size_t, 1>> _exponents;
+};
+
+template<std::floating_point Float>
+template<in_matrix Filter>
+    requires complex<value_type_t<Filter>>
+auto block_float_filter<Float>::filter(Filter filter) -> void
+{
+    _filter    = stdex::mdarray<complex_q15, stdex::dextents<size_t, 2>>{filter.extent(0), filter.extent(1)};
+    _exponents = stdex::mdarray<int, stdex::dextents<size_t, 1>>{filter.extent(0)};
+
+    for (auto p = size_t(0); p < _filter.extent(0); ++p) {
+        _exponents(p) = detail::quantize_block_float(
+            [filter, p](size_t i) { return static_cast<Float>(filter(p, i).real()); },
+            [filter, p](size_t i) { return static_cast<Float>(filter(p, i).imag()); },
+            stdex::submdspan(_filter.to_mdspan(), p, stdex::full_extent)
+        );
+    }
+}
+
+template<std::floating_point Float>
+auto block_float_filter<Float>::operator[](std::integral auto index) const noexcept -> block_float_row
+{
+    return {
+        .mantissa = stdex::submdspan(_filter.to_mdspan(), index, stdex::full_extent),
+        .exponent = _exponents(index),
+    };
+}
+
+template<std::floating_point Float>
+template<std::integral Index, inout_matrix_of<Float> Accumulator>
+auto block_float_filter<Float>::operator()(block_float_row fdl, Index filter_index, Accumulator accumulator) -> void
+{
+    (*this)(std::span<block_float_row const>{&fdl, 1}, std::span<Index const>{&filter_index, 1}, accumulator);
+}
+
+template<std::floating_point Float>
+template<std::integral Index, inout_matrix_of<Float> Accumulator>
+auto block_float_filter<Float>::operator()(
+    std::span<block_float_row const> fdl,
+    std::span<Index const> filter_indices,
+    Accumulator accumulator
+) -> void
+{
+    assert(fdl.size() == filter_indices.size());
+    assert(fdl.size() <= max_batch_size);
+
+    auto x        = std::array<complex_q15 const*, max_batch_size>{};
+    auto y        = std::array<complex_q15 const*, max_batch_size>{};
+    auto shifts   = std::array<int, max_batch_size>{};
+    auto products = std::array<int, max_batch_size>{};
+    auto rows     = std::size_t(0);
+    auto largest  = block_float_row::silent;
+
+    for (auto i = std::size_t(0); i < fdl.size(); ++i) {
+        auto const subfilter = (*this)[filter_indices[i]];
+        if (fdl[i].exponent == block_float_row::silent or subfilter.exponent == block_float_row::silent) {
+            continue;
+        }
+
+        x[rows]        = fdl[i].mantissa.data_handle();
+        y[rows]        = subfilter.mantissa.data_handle();
+        products[rows] = fdl[i].exponent + subfilter.exponent;
+        largest        = std::max(largest, products[rows]);
+        ++rows;
+    }
+
+    // Too small to reach the 32-bit sum of the largest product
+    auto kept = std::size_t(0);
+    for (auto i = std::size_t(0); i < rows; ++i) {
+        auto const shift = detail::block_float_headroom + largest - products[i];
+        if (shift < 32) {
+            x[kept]      = x[i];
+            y[kept]      = y[i];
+            shifts[kept] = shift;
+            ++kept;
+        }
+    }
+
+    if (kept == 0) {
+        return;
+    }
+
+    // Both mantissas are scaled by 2^15
+    auto const scale = static_cast<Float>(std::ldexp(1.0, largest + detail::block_float_headroom - 30));
+    detail::multiply_accumulate_block_float(
+        x.data(),
+        y.data(),
+        shifts.data(),
+        kept,
+        scale,
+        &accumulator(0, 0),
+        &accumulator(1, 0),
+        static_cast<std::size_t>(accumulator.extent(1))
+    );
+}
+
+}  // namespace neo::convolution
@@ -27,17 +27,19 @@ using upola_convolver = uniform_partitioned_convolver<overlap_add<Complex>, dens
 template<neo::complex Complex>
 using upola_convolver_v2 = overlap_add_convolver<Complex, dense_fdl<Complex>, dense_filter<Complex>>;
 
+/// \brief The spectrum stays split-complex from the real FFT through the FDL & filter back to the inverse FFT.
 /// \ingroup neo-convolution
 template<complex Complex>
 using split_upola_convolver = uniform_partitioned_convolver<
-    overlap_add<Complex>,
+    split_overlap_add<Complex>,
     dense_split_fdl<value_type_t<Complex>>,
     dense_split_filter<value_type_t<Complex>>>;
 
+/// \brief The spectrum stays split-complex from the real FFT through the FDL & filter back to the inverse FFT.
 /// \ingroup neo-convolution
 template<complex Complex>
 using split_upols_convolver = uniform_partitioned_convolver<
-    overlap_save<Complex>,
+    split_overlap_save<Complex>,
     dense_split_fdl<value_type_t<Complex>>,
     dense_split_filter<value_type_t<Complex>>>;
 
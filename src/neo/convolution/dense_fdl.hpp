@@ -2,10 +2,14 @@
 
 #pragma once
 
+#include <neo/algorithm/allmatch.hpp>
 #include <neo/algorithm/copy.hpp>
 #include <neo/complex/complex.hpp>
 #include <neo/complex/split_complex.hpp>
 #include <neo/container/mdspan.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#include <vector>
 
 namespace neo::convolution {
 
@@ -17,20 +21,28 @@ struct dense_fdl
 
     dense_fdl() = default;
 
-    explicit dense_fdl(stdex::dextents<size_t, 2> extents) : _fdl{extents} {}
+    explicit dense_fdl(stdex::dextents<size_t, 2> extents) : _fdl{extents}, _silent(extents.extent(0), true) {}
 
     [[nodiscard]] auto operator[](std::integral auto index) const noexcept -> in_vector_of<Complex> auto
     {
         return stdex::submdspan(_fdl.to_mdspan(), index, stdex::full_extent);
     }
 
+    /// True if the row is all zero, products with it can be skipped.
+    [[nodiscard]] auto is_silent(std::integral auto index) const noexcept -> bool
+    {
+        return _silent[static_cast<size_t>(index)];
+    }
+
     auto insert(in_vector_of<Complex> auto input, std::integral auto index) noexcept -> void
     {
         copy(input, stdex::submdspan(_fdl.to_mdspan(), index, stdex::full_extent));
+        _silent[static_cast<size_t>(index)] = allmatch(input, [](auto val) { return val == Complex{}; });
     }
 
 private:
     stdex::mdarray<Complex, stdex::dextents<size_t, 2>> _fdl{};
+    std::vector<bool> _silent;
 };
 
 /// \ingroup neo-convolution
@@ -41,7 +53,10 @@ struct dense_split_fdl
 
     dense_split_fdl() = default;
 
-    explicit dense_split_fdl(stdex::dextents<size_t, 2> extents) : _fdl{2, extents.extent(0), extents.extent(1)} {}
+    explicit dense_split_fdl(stdex::dextents<size_t, 2> extents)
+        : _fdl{2, extents.extent(0), extents.extent(1)}
+        , _silent(extents.extent(0), true)
+    {}
 
     [[nodiscard]] auto operator[](std::integral auto index) const noexcept
     {
@@ -51,15 +66,37 @@ struct dense_split_fdl
         };
     }
 
+    /// True if the row is all zero, products with it can be skipped.
+    [[nodiscard]] auto is_silent(std::integral auto index) const noexcept -> bool
+    {
+        return _silent[static_cast<size_t>(index)];
+    }
+
     auto insert(in_vector auto input, std::integral auto index) noexcept -> void
     {
+        using Complex = value_type_t<decltype(input)>;
+
         auto real = stdex::submdspan(_fdl.to_mdspan(), 0, index, stdex::full_extent);
         auto imag = stdex::submdspan(_fdl.to_mdspan(), 1, index, stdex::full_extent);
         copy(input, split_complex{real, imag});
+
+        _silent[static_cast<size_t>(index)] = allmatch(input, [](auto val) { return val == Complex{}; });
+    }
+
+    /// Spectrum of a split overlap, two plain row copies.
+    template<in_vector InVec>
+    auto insert(split_complex<InVec> input, std::integral auto index) noexcept -> void
+    {
+        copy(input.real, stdex::submdspan(_fdl.to_mdspan(), 0, index, stdex::full_extent));
+        copy(input.imag, stdex::submdspan(_fdl.to_mdspan(), 1, index, stdex::full_extent));
+
+        auto const is_zero                  = [](auto val) { return val == value_type_t<InVec>{}; };
+        _silent[static_cast<size_t>(index)] = allmatch(input.real, is_zero) and allmatch(input.imag, is_zero);
     }
 
 private:
     stdex::mdarray<Float, stdex::dextents<size_t, 3>> _fdl{};
+    std::vector<bool> _silent;
 };
 
 }  // namespace neo::convolution
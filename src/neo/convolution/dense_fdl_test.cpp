@@ -19,3 +19,41 @@ TEMPLATE_TEST_CASE(
     using Fdl     = neo::convolution::dense_fdl<Complex>;
     STATIC_REQUIRE(std::same_as<typename Fdl::value_type, Complex>);
 }
+
+TEMPLATE_TEST_CASE("neo/convolution: dense_fdl(is_silent)", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto dense = neo::convolution::dense_fdl<Complex>{stdex::dextents<std::size_t, 2>{3, 8}};
+    auto split = neo::convolution::dense_split_fdl<Float>{stdex::dextents<std::size_t, 2>{3, 8}};
+    for (auto i = std::size_t(0); i < 3; ++i) {
+        REQUIRE(dense.is_silent(i));
+        REQUIRE(split.is_silent(i));
+    }
+
+    auto row = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{8};
+    row(7)   = Complex{Float(0), Float(1e-30)};
+    dense.insert(row.to_mdspan(), 1);
+    split.insert(row.to_mdspan(), 1);
+    REQUIRE(dense.is_silent(0));
+    REQUIRE_FALSE(dense.is_silent(1));
+    REQUIRE_FALSE(split.is_silent(1));
+
+    auto parts  = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{2, 8};
+    parts(0, 3) = Float(0.5);
+    split.insert(
+        neo::split_complex{
+            stdex::submdspan(parts.to_mdspan(), 0, stdex::full_extent),
+            stdex::submdspan(parts.to_mdspan(), 1, stdex::full_extent),
+        },
+        2
+    );
+    REQUIRE_FALSE(split.is_silent(2));
+
+    row(7) = Complex{};
+    dense.insert(row.to_mdspan(), 1);
+    split.insert(row.to_mdspan(), 1);
+    REQUIRE(dense.is_silent(1));
+    REQUIRE(split.is_silent(1));
+}
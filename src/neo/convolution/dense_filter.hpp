@@ -8,8 +8,14 @@
 #include <neo/algorithm/multiply_add.hpp>
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
+#include <neo/convolution/fdl_index.hpp>
 #include <neo/type_traits/value_type_t.hpp>
 
+#include <array>
+#include <cassert>
+#include <span>
+#include <utility>
+
 namespace neo::convolution {
 
 /// \ingroup neo-convolution
@@ -34,7 +40,30 @@ struct dense_filter
         multiply_add(fdl, subfilter, accumulator, accumulator);
     }
 
+    /// Sums a batch of segments into the accumulator in one pass, see fdl_index::batched.
+    template<in_vector_of<Complex> FdlRow, std::integral Index, inout_vector_of<Complex> Accumulator>
+    auto operator()(std::span<FdlRow const> fdl, std::span<Index const> filter_indices, Accumulator accumulator)
+        -> void
+    {
+        assert(fdl.size() == filter_indices.size());
+        assert(fdl.size() <= max_batch_size);
+
+        auto subfilters = std::array<row_type, max_batch_size>{};
+        for (auto i = std::size_t(0); i < fdl.size(); ++i) {
+            subfilters[i] = stdex::submdspan(std::as_const(_filter).to_mdspan(), filter_indices[i], stdex::full_extent);
+        }
+        multiply_accumulate(fdl, std::span<row_type const>{subfilters.data(), fdl.size()}, accumulator);
+    }
+
 private:
+    using row_type = decltype(stdex::submdspan(
+        std::declval<stdex::mdarray<Complex, stdex::dextents<size_t, 2>> const&>().to_mdspan(),
+        size_t{},
+        stdex::full_extent
+    ));
+
+    static constexpr auto const max_batch_size = static_cast<std::size_t>(fdl_index<>::batch_size);
+
     stdex::mdarray<Complex, stdex::dextents<size_t, 2>> _filter;
 };
 
@@ -77,7 +106,43 @@ struct dense_split_filter
         multiply_add(fdl, subfilter, out, out);
     }
 
+    /// Sums a batch of segments into the accumulator in one pass, see fdl_index::batched.
+    template<in_vector InVec, std::integral Index, inout_matrix_of<Float> Accumulator>
+    auto operator()(
+        std::span<split_complex<InVec> const> fdl,
+        std::span<Index const> filter_indices,
+        Accumulator accumulator
+    ) -> void
+    {
+        assert(fdl.size() == filter_indices.size());
+        assert(fdl.size() <= max_batch_size);
+
+        auto subfilters = std::array<split_complex<row_type>, max_batch_size>{};
+        for (auto i = std::size_t(0); i < fdl.size(); ++i) {
+            auto const filter = std::as_const(_filter).to_mdspan();
+            subfilters[i]     = split_complex{
+                stdex::submdspan(filter, 0, filter_indices[i], stdex::full_extent),
+                stdex::submdspan(filter, 1, filter_indices[i], stdex::full_extent),
+            };
+        }
+
+        auto const out = split_complex{
+            stdex::submdspan(accumulator, 0, stdex::full_extent),
+            stdex::submdspan(accumulator, 1, stdex::full_extent),
+        };
+        multiply_accumulate(fdl, std::span<split_complex<row_type> const>{subfilters.data(), fdl.size()}, out);
+    }
+
 private:
+    using row_type = decltype(stdex::submdspan(
+        std::declval<stdex::mdarray<Float, stdex::dextents<size_t, 3>> const&>().to_mdspan(),
+        size_t{},
+        size_t{},
+        stdex::full_extent
+    ));
+
+    static constexpr auto const max_batch_size = static_cast<std::size_t>(fdl_index<>::batch_size);
+
     stdex::mdarray<Float, stdex::dextents<size_t, 3>> _filter;
 };
 
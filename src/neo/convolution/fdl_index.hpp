@@ -6,6 +6,10 @@
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
 
+#include <algorithm>
+#include <array>
+#include <span>
+
 namespace neo::convolution {
 
 /// \ingroup neo-convolution
@@ -14,6 +18,9 @@ struct fdl_index
 {
     using value_type = IndexType;
 
+    /// Maximum number of (segment, filter) pairs handed to a batch callback at once.
+    static constexpr auto const batch_size = IndexType(8);
+
     fdl_index() noexcept = default;
 
     explicit fdl_index(IndexType num_segments) : _num_segments{num_segments} {}
@@ -35,6 +42,37 @@ struct fdl_index
         }
     }
 
+    /// \brief Same order as operator(), but the pairs are grouped into batches of up to batch_size.
+    ///
+    /// Lets the filter sum several segments into the accumulator in a single pass.
+    template<
+        std::invocable<IndexType> CopyCallback,
+        std::invocable<std::span<IndexType const>, std::span<IndexType const>> BatchCallback>
+    auto batched(CopyCallback copy_callback, BatchCallback callback) -> void
+    {
+        copy_callback(_write_pos);
+
+        auto segments = std::array<IndexType, static_cast<std::size_t>(batch_size)>{};
+        auto filters  = std::array<IndexType, static_cast<std::size_t>(batch_size)>{};
+
+        for (IndexType first{0}; first < _num_segments; first += batch_size) {
+            auto const count = std::min(IndexType(_num_segments - first), batch_size);
+            for (IndexType i{0}; i < count; ++i) {
+                auto const segment = static_cast<IndexType>(first + i);
+                auto const index   = static_cast<std::size_t>(i);
+                segments[index]    = segment;
+                filters[index] = static_cast<IndexType>((_write_pos + _num_segments - segment) % _num_segments);
+            }
+
+            auto const size = static_cast<std::size_t>(count);
+            callback(std::span<IndexType const>{segments.data(), size}, std::span<IndexType const>{filters.data(), size});
+        }
+
+        if (++_write_pos; _write_pos >= _num_segments) {
+            reset();
+        }
+    }
+
 private:
     IndexType _num_segments{0};
     IndexType _write_pos{0};
@@ -3,6 +3,11 @@
 #include "fdl_index.hpp"
 
 #include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <span>
+#include <utility>
+#include <vector>
 
 TEMPLATE_TEST_CASE("neo/convolution: fdl_index", "", int, unsigned, std::ptrdiff_t, std::size_t)
 {
@@ -66,3 +71,35 @@ TEMPLATE_TEST_CASE("neo/convolution: fdl_index", "", int, unsigned, std::ptrdiff
         indexer([](auto i) { REQUIRE(i == Index(1)); }, check_multiply_iteration_2);
     }
 }
+
+TEMPLATE_TEST_CASE("neo/convolution: fdl_index(batched)", "", int, unsigned, std::ptrdiff_t, std::size_t)
+{
+    using Index = TestType;
+
+    auto const num_segments = GENERATE(as<Index>{}, 1, 3, 8, 9, 17, 24);
+    CAPTURE(num_segments);
+
+    auto single  = neo::convolution::fdl_index<Index>{num_segments};
+    auto batched = neo::convolution::fdl_index<Index>{num_segments};
+
+    for (auto block = 0; block < 2 * static_cast<int>(num_segments) + 1; ++block) {
+        auto expected = std::vector<std::pair<Index, Index>>{};
+        auto write    = Index(0);
+        single([&](auto i) { write = i; }, [&](auto s, auto f) { expected.emplace_back(s, f); });
+
+        auto pairs = std::vector<std::pair<Index, Index>>{};
+        batched.batched(
+            [&](auto i) { REQUIRE(i == write); },
+            [&](std::span<Index const> segments, std::span<Index const> filters) {
+                REQUIRE(segments.size() == filters.size());
+                REQUIRE(segments.size() > 0);
+                REQUIRE(segments.size() <= static_cast<std::size_t>(neo::convolution::fdl_index<Index>::batch_size));
+                for (auto i = std::size_t(0); i < segments.size(); ++i) {
+                    pairs.emplace_back(segments[i], filters[i]);
+                }
+            }
+        );
+
+        REQUIRE(pairs == expected);
+    }
+}
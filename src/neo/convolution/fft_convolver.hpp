@@ -7,6 +7,7 @@
 #include <neo/algorithm/multiply.hpp>
 #include <neo/algorithm/scale.hpp>
 #include <neo/container/mdspan.hpp>
+#include <neo/convolution/ifft_scaling.hpp>
 #include <neo/convolution/mode.hpp>
 #include <neo/fft/rfft.hpp>
 
@@ -19,7 +20,12 @@ namespace neo::convolution {
 template<std::floating_point Float>
 struct fft_convolver
 {
-    fft_convolver(std::size_t signal_size, std::size_t patch_size) : _signal_size{signal_size}, _patch_size{patch_size}
+    /// With ifft_scaling::filter the 1/N of the inverse transform is applied
+    /// while the patch is zero-padded, which only touches patch_size samples.
+    fft_convolver(std::size_t signal_size, std::size_t patch_size, ifft_scaling scaling = ifft_scaling::output)
+        : _signal_size{signal_size}
+        , _patch_size{patch_size}
+        , _scaling{scaling}
     {
         assert(_signal_size > 1);
         assert(_patch_size > 1);
@@ -27,6 +33,8 @@ struct fft_convolver
 
     [[nodiscard]] auto signal_size() const noexcept -> std::size_t { return _signal_size; }
 
+    [[nodiscard]] auto scaling() const noexcept -> ifft_scaling { return _scaling; }
+
     [[nodiscard]] auto patch_size() const noexcept -> std::size_t { return _patch_size; }
 
     [[nodiscard]] auto output_size() const noexcept -> std::size_t
@@ -45,7 +53,11 @@ struct fft_convolver
         auto const patch_spectrum  = _patch_spectrum.to_mdspan();
 
         zero_pad_and_transform_forward(signal, signal_spectrum);
-        zero_pad_and_transform_forward(patch, patch_spectrum);
+        if (_scaling == ifft_scaling::filter) {
+            zero_pad_and_transform_forward(patch, patch_spectrum, Float(1) / Float(_plan.size()));
+        } else {
+            zero_pad_and_transform_forward(patch, patch_spectrum);
+        }
         multiply(signal_spectrum, patch_spectrum, signal_spectrum);
         transform_backward(signal_spectrum, output);
     }
@@ -59,16 +71,29 @@ private:
         rfft(_plan, tmp, out);
     }
 
+    auto zero_pad_and_transform_forward(in_vector auto in, out_vector auto out, Float gain)
+    {
+        auto const tmp = _tmp.to_mdspan();
+        for (auto i = std::size_t(0); i < static_cast<std::size_t>(in.extent(0)); ++i) {
+            tmp[i] = static_cast<Float>(in[i]) * gain;
+        }
+        fill(stdex::submdspan(tmp, std::tuple{in.extent(0), tmp.extent(0)}), Float(0));
+        rfft(_plan, tmp, out);
+    }
+
     auto transform_backward(in_vector auto in, out_vector auto out)
     {
         auto const tmp = _tmp.to_mdspan();
         irfft(_plan, in, tmp);
-        scale(Float(1) / Float(_plan.size()), tmp);
+        if (_scaling == ifft_scaling::output) {
+            scale(Float(1) / Float(_plan.size()), tmp);
+        }
         copy(stdex::submdspan(tmp, std::tuple{0, output_size()}), out);
     }
 
     std::size_t _signal_size;
     std::size_t _patch_size;
+    ifft_scaling _scaling;
     fft::rfft_plan<Float> _plan{fft::from_order, fft::next_order(output_size())};
 
     stdex::mdarray<Float, stdex::dextents<size_t, 1>> _tmp{_plan.size()};
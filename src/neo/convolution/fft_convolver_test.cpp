@@ -36,3 +36,28 @@ TEMPLATE_TEST_CASE("neo/convolution: fft_convolve", "", float, double)
     REQUIRE(output.extent(0) == output_size<mode::full>(signal_size, patch_size));
     REQUIRE(neo::allclose(stdex::submdspan(output.to_mdspan(), std::tuple{0, signal_size}), signal.to_mdspan()));
 }
+
+TEMPLATE_TEST_CASE("neo/convolution: fft_convolver(ifft_scaling)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const signal_size = GENERATE(as<std::size_t>{}, 8, 143, 1024);
+    auto const patch_size  = GENERATE(as<std::size_t>{}, 4, 78, 666);
+    CAPTURE(signal_size);
+    CAPTURE(patch_size);
+
+    auto const signal = neo::generate_noise_signal<Float>(signal_size, Catch::getSeed());
+    auto const patch  = neo::generate_noise_signal<Float>(patch_size, Catch::getSeed() + 1U);
+
+    auto output_scaled = fft_convolver<Float>{signal_size, patch_size};
+    auto filter_scaled = fft_convolver<Float>{signal_size, patch_size, ifft_scaling::filter};
+    REQUIRE(output_scaled.scaling() == ifft_scaling::output);
+    REQUIRE(filter_scaled.scaling() == ifft_scaling::filter);
+
+    auto expected = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{output_scaled.output_size()};
+    auto output   = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{filter_scaled.output_size()};
+    output_scaled(signal.to_mdspan(), patch.to_mdspan(), expected.to_mdspan());
+    filter_scaled(signal.to_mdspan(), patch.to_mdspan(), output.to_mdspan());
+
+    REQUIRE(neo::allclose(output.to_mdspan(), expected.to_mdspan(), Float(1e-4)));
+}
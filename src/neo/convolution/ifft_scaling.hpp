@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/algorithm/copy.hpp>
+#include <neo/algorithm/scale.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace neo::convolution {
+
+/// \brief Where a convolver applies the 1/N of its inverse transform.
+/// \ingroup neo-convolution
+enum struct ifft_scaling
+{
+    /// Every block scales the output of the inverse transform.
+    output,
+
+    /// The filter spectrum is scaled once when it is set, the inverse
+    /// transform stays unnormalized. Saves a pass over the output per block.
+    filter,
+};
+
+namespace detail {
+
+/// Copy of the filter spectrum with the 1/N of a transform_size-point inverse transform folded in.
+template<in_matrix InMat>
+[[nodiscard]] auto prescale_filter(InMat filter, std::size_t transform_size)
+{
+    using Value = value_type_t<InMat>;
+    using Float = value_type_t<Value>;
+
+    auto scaled = stdex::mdarray<Value, stdex::dextents<std::size_t, 2>>{filter.extents()};
+    copy(filter, scaled.to_mdspan());
+    scale(Float(1) / static_cast<Float>(transform_size), scaled.to_mdspan());
+    return scaled;
+}
+
+/// \brief Hands callbacks passed along with a prescaled filter, e.g. a sparsity or importance function, the
+/// unscaled coefficients.
+///
+/// Thresholds are usually derived from the unscaled filter, so pruning has to see the same values. The transform
+/// size is a power of two, multiplying by it restores the coefficients exactly. Anything else, e.g. a mask, is passed
+/// through unchanged.
+template<typename Value, typename Arg>
+[[nodiscard]] auto unscaled_callback(Arg arg, std::size_t transform_size)
+{
+    if constexpr (not requires { arg.extents(); } and std::invocable<Arg const&, std::size_t, std::size_t, Value>) {
+        using Float = value_type_t<Value>;
+
+        auto const size = static_cast<Float>(transform_size);
+        return [arg = std::move(arg), size](auto row, auto col, auto const& value) {
+            auto unscaled = static_cast<Value>(value);
+            unscaled *= size;
+            return arg(row, col, unscaled);
+        };
+    } else {
+        return arg;
+    }
+}
+
+}  // namespace detail
+
+}  // namespace neo::convolution
@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace neo::convolution {
+
+/// \brief Sparse filter with nested level-of-detail sparsity.
+///
+/// Every level keeps the bins with an importance above its threshold, the
+/// thresholds are ascending, so level 0 is the most accurate and each level is
+/// a superset of the next one. The bins of each partition are stored once,
+/// sorted by descending importance, and a level is just a cut-off per
+/// partition. Switching the level is a single store and can happen every block.
+///
+/// \ingroup neo-convolution
+template<complex Complex>
+struct lod_filter
+{
+    using value_type       = Complex;
+    using size_type        = std::size_t;
+    using index_type       = std::size_t;
+    using accumulator_type = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>;
+
+    lod_filter() = default;
+    ~lod_filter() = default;
+
+    /// Copies & moves are not synchronized with set_level(), the requested level is carried over.
+    lod_filter(lod_filter const& other);
+    lod_filter(lod_filter&& other) noexcept;
+    auto operator=(lod_filter const& other) -> lod_filter&;
+    auto operator=(lod_filter&& other) noexcept -> lod_filter&;
+
+    template<in_matrix_of<Complex> InMat, typename Importance, in_vector Thresholds>
+    auto filter(InMat input, Importance importance, Thresholds thresholds) -> void;
+
+    [[nodiscard]] auto num_levels() const noexcept -> size_type;
+
+    /// Number of complex multiply-adds per block at \p level.
+    [[nodiscard]] auto num_macs(size_type level) const noexcept -> size_type;
+
+    [[nodiscard]] auto level() const noexcept -> size_type;
+
+    /// Highest column with a coefficient at the active level, 0 before filter() was called.
+    [[nodiscard]] auto max_active_bin() const noexcept -> index_type;
+
+    /// \brief Requests a level, takes effect with the next apply_update().
+    ///
+    /// Can be called from any thread while operator() runs, but not concurrently with filter().
+    auto set_level(size_type level) noexcept -> void;
+
+    /// Activates the last requested level, called by the convolver at each block boundary.
+    /// A level that is out of range for the current filter is clamped to the coarsest one.
+    auto apply_update() noexcept -> bool;
+
+    template<in_vector_of<Complex> FdlRow, std::integral Index, inout_vector_of<Complex> Accumulator>
+    auto operator()(FdlRow fdl, Index filter_index, Accumulator accumulator) -> void;
+
+private:
+    std::vector<Complex> _values;
+    std::vector<index_type> _columns;
+    std::vector<size_type> _row_offsets;
+    stdex::mdarray<size_type, stdex::dextents<size_type, 2>> _cutoffs;
+    std::vector<index_type> _max_active_bins;
+    std::atomic<size_type> _num_levels{0};
+    std::atomic<size_type> _level{0};
+    size_type _active_level{0};
+};
+
+template<complex Complex>
+lod_filter<Complex>::lod_filter(lod_filter const& other)
+    : _values{other._values}
+    , _columns{other._columns}
+    , _row_offsets{other._row_offsets}
+    , _cutoffs{other._cutoffs}
+    , _max_active_bins{other._max_active_bins}
+    , _num_levels{other._num_levels.load(std::memory_order_relaxed)}
+    , _level{other._level.load(std::memory_order_relaxed)}
+    , _active_level{other._active_level}
+{}
+
+template<complex Complex>
+lod_filter<Complex>::lod_filter(lod_filter&& other) noexcept
+    : _values{std::move(other._values)}
+    , _columns{std::move(other._columns)}
+    , _row_offsets{std::move(other._row_offsets)}
+    , _cutoffs{std::move(other._cutoffs)}
+    , _max_active_bins{std::move(other._max_active_bins)}
+    , _num_levels{other._num_levels.load(std::memory_order_relaxed)}
+    , _level{other._level.load(std::memory_order_relaxed)}
+    , _active_level{other._active_level}
+{}
+
+template<complex Complex>
+auto lod_filter<Complex>::operator=(lod_filter const& other) -> lod_filter&
+{
+    return *this = lod_filter{other};
+}
+
+template<complex Complex>
+auto lod_filter<Complex>::operator=(lod_filter&& other) noexcept -> lod_filter&
+{
+    _values          = std::move(other._values);
+    _columns         = std::move(other._columns);
+    _row_offsets     = std::move(other._row_offsets);
+    _cutoffs         = std::move(other._cutoffs);
+    _max_active_bins = std::move(other._max_active_bins);
+    _num_levels.store(other._num_levels.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    _level.store(other._level.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    _active_level = other._active_level;
+    return *this;
+}
+
+template<complex Complex>
+template<in_matrix_of<Complex> InMat, typename Importance, in_vector Thresholds>
+auto lod_filter<Complex>::filter(InMat input, Importance importance, Thresholds thresholds) -> void
+{
+    using Score = std::decay_t<decltype(importance(size_type(0), size_type(0), input(0, 0)))>;
+
+    auto const rows       = static_cast<size_type>(input.extent(0));
+    auto const cols       = static_cast<size_type>(input.extent(1));
+    auto const num_levels = static_cast<size_type>(thresholds.extent(0));
+    assert(num_levels > 0);
+
+    for (auto level = size_type(1); level < num_levels; ++level) {
+        assert(thresholds[level - 1] <= thresholds[level]);
+    }
+
+    _values.clear();
+    _columns.clear();
+    _row_offsets.assign(rows + 1, 0);
+    _cutoffs = stdex::mdarray<size_type, stdex::dextents<size_type, 2>>{rows, num_levels};
+    _max_active_bins.assign(num_levels, 0);
+    _num_levels.store(num_levels, std::memory_order_relaxed);
+    _level.store(0, std::memory_order_relaxed);
+    _active_level = 0;
+
+    auto scores = std::vector<Score>(cols);
+    auto order  = std::vector<index_type>(cols);
+
+    for (auto row = size_type(0); row < rows; ++row) {
+        for (auto col = size_type(0); col < cols; ++col) {
+            scores[col] = importance(row, col, input(row, col));
+        }
+
+        std::iota(order.begin(), order.end(), index_type(0));
+        std::stable_sort(order.begin(), order.end(), [&scores](index_type lhs, index_type rhs) {
+            return scores[lhs] > scores[rhs];
+        });
+
+        // Only the most accurate level is stored, the others are prefixes of it
+        auto count = size_type(0);
+        while (count < cols and scores[order[count]] > thresholds[0]) {
+            _values.push_back(static_cast<Complex>(input(row, order[count])));
+            _columns.push_back(order[count]);
+            ++count;
+        }
+
+        auto cutoff = count;
+        for (auto level = size_type(0); level < num_levels; ++level) {
+            while (cutoff > 0 and not(scores[order[cutoff - 1]] > thresholds[level])) {
+                --cutoff;
+            }
+            _cutoffs(row, level) = cutoff;
+
+            if (cutoff > 0) {
+                auto const kept         = std::next(order.begin(), static_cast<std::ptrdiff_t>(cutoff));
+                _max_active_bins[level] = std::max(_max_active_bins[level], *std::max_element(order.begin(), kept));
+            }
+        }
+
+        _row_offsets[row + 1] = _values.size();
+    }
+}
+
+template<complex Complex>
+auto lod_filter<Complex>::num_levels() const noexcept -> size_type
+{
+    return _num_levels.load(std::memory_order_relaxed);
+}
+
+template<complex Complex>
+auto lod_filter<Complex>::num_macs(size_type level) const noexcept -> size_type
+{
+    assert(level < num_levels());
+
+    auto macs = size_type(0);
+    for (auto row = size_type(0); row < _cutoffs.extent(0); ++row) {
+        macs += _cutoffs(row, level);
+    }
+    return macs;
+}
+
+template<complex Complex>
+auto lod_filter<Complex>::level() const noexcept -> size_type
+{
+    return _level.load(std::memory_order_relaxed);
+}
+
+template<complex Complex>
+auto lod_filter<Complex>::max_active_bin() const noexcept -> index_type
+{
+    if (_max_active_bins.empty()) {
+        return 0;
+    }
+    return _max_active_bins[_active_level];
+}
+
+template<complex Complex>
+auto lod_filter<Complex>::set_level(size_type level) noexcept -> void
+{
+    assert(level < num_levels());
+    _level.store(level, std::memory_order_relaxed);
+}
+
+template<complex Complex>
+auto lod_filter<Complex>::apply_update() noexcept -> bool
+{
+    auto const count = num_levels();
+    if (count == 0) {
+        return false;
+    }
+
+    auto const level = std::min(_level.load(std::memory_order_relaxed), count - 1);
+    if (level == _active_level) {
+        return false;
+    }
+
+    _active_level = level;
+    return true;
+}
+
+template<complex Complex>
+template<in_vector_of<Complex> FdlRow, std::integral Index, inout_vector_of<Complex> Accumulator>
+auto lod_filter<Complex>::operator()(FdlRow fdl, Index filter_index, Accumulator accumulator) -> void
+{
+    auto const row   = static_cast<size_type>(filter_index);
+    auto const first = _row_offsets[row];
+    auto const last  = first + _cutoffs(row, _active_level);
+
+    // Columns are in importance order, so the accumulator is scattered
+    for (auto i = first; i < last; ++i) {
+        auto const col   = _columns[i];
+        accumulator[col] = accumulator[col] + fdl[col] * _values[i];
+    }
+}
+
+}  // namespace neo::convolution
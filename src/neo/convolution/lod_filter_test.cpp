@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+
+#include "lod_filter.hpp"
+
+#include <neo/algorithm/allclose.hpp>
+#include <neo/convolution/sparse_convolver.hpp>
+#include <neo/convolution/sparsity_budget.hpp>
+#include <neo/testing/convolution.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <array>
+#include <complex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+static_assert(std::is_move_constructible_v<neo::convolution::lod_upols_convolver<std::complex<float>>>);
+static_assert(std::is_move_assignable_v<neo::convolution::lod_upola_convolver<std::complex<float>>>);
+static_assert(std::is_copy_constructible_v<neo::convolution::lod_upols_convolver<std::complex<float>>>);
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/convolution: lod_filter",
+    "",
+    (neo::convolution::lod_upola_convolver, neo::convolution::lod_upols_convolver),
+    (std::complex<float>, std::complex<double>)
+)
+{
+    using Convolver = TestType;
+    using Complex   = typename Convolver::value_type;
+    using Float     = typename Complex::value_type;
+
+    auto const block_size = GENERATE(as<std::size_t>{}, 128, 256);
+    CAPTURE(block_size);
+
+    auto const filter  = neo::generate_noise_filter<Float>(block_size * 8UL, block_size, Catch::getSeed());
+    auto const channel = filter.to_mdspan();
+
+    auto const num_bins   = channel.extent(0) * channel.extent(1);
+    auto const importance = neo::convolution::a_weighted_importance<Float>{channel, 44'100.0};
+
+    auto const budgets    = std::array{num_bins, num_bins / 2, num_bins / 8, std::size_t(0)};
+    auto const thresholds = [&] {
+        auto t = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{budgets.size()};
+        for (auto i = std::size_t(0); i < budgets.size(); ++i) {
+            t(i) = neo::convolution::budget_threshold(channel, importance, budgets[i]);
+        }
+        return t;
+    }();
+
+    auto lod = neo::convolution::lod_filter<Complex>{};
+    lod.filter(channel, importance, thresholds.to_mdspan());
+    REQUIRE(lod.num_levels() == budgets.size());
+    for (auto level = std::size_t(0); level < budgets.size(); ++level) {
+        // Scores of noise are unique, so the budget is hit exactly
+        REQUIRE(lod.num_macs(level) == budgets[level]);
+    }
+
+    auto const signal = neo::generate_noise_signal<Float>(block_size * 16UL, Catch::getSeed());
+
+    auto const level = GENERATE(as<std::size_t>{}, 0, 1, 2, 3);
+    CAPTURE(level);
+
+    auto convolver = Convolver{};
+    convolver.filter(channel, importance, thresholds.to_mdspan());
+    convolver.set_level(level);
+
+    auto const sparsity = [&importance, threshold = thresholds(level)](auto row, auto col, auto value) {
+        return importance(row, col, value) > threshold;
+    };
+
+    using Reference = std::conditional_t<
+        std::same_as<Convolver, neo::convolution::lod_upola_convolver<Complex>>,
+        neo::convolution::sparse_upola_convolver<Complex>,
+        neo::convolution::sparse_upols_convolver<Complex>>;
+
+    auto reference = Reference{};
+    reference.filter(channel, sparsity);
+
+    auto output   = signal;
+    auto expected = signal;
+    for (auto i = std::size_t(0); i < signal.extent(0); i += block_size) {
+        auto const range = std::tuple{i, i + block_size};
+        convolver(stdex::submdspan(output.to_mdspan(), range));
+        reference(stdex::submdspan(expected.to_mdspan(), range));
+    }
+    REQUIRE(neo::allclose(output.to_mdspan(), expected.to_mdspan(), Float(1e-4)));
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: lod_filter(set_level)", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const block_size = std::size_t(128);
+    auto const filter     = neo::generate_noise_filter<Float>(block_size * 4UL, block_size, Catch::getSeed());
+    auto const channel    = filter.to_mdspan();
+
+    auto const score      = [](std::size_t, std::size_t col, auto) { return static_cast<Float>(col); };
+    auto const thresholds = std::array{Float(-1), Float(31.5), Float(1000)};
+    auto const levels     = stdex::mdspan{thresholds.data(), stdex::extents{thresholds.size()}};
+
+    auto lod = neo::convolution::lod_filter<Complex>{};
+    REQUIRE(lod.max_active_bin() == 0);
+
+    lod.filter(channel, score, levels);
+    REQUIRE(lod.level() == 0);
+    REQUIRE(lod.num_macs(0) == channel.extent(0) * channel.extent(1));
+    REQUIRE(lod.num_macs(1) == channel.extent(0) * (channel.extent(1) - 32));
+    REQUIRE(lod.num_macs(2) == 0);
+
+    auto fdl         = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{channel.extent(1)};
+    auto accumulator = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{channel.extent(1)};
+    for (auto i = std::size_t(0); i < fdl.extent(0); ++i) {
+        fdl(i) = Complex(Float(1));
+    }
+
+    lod.set_level(1);
+    REQUIRE(lod.level() == 1);
+    REQUIRE(lod.apply_update());
+    REQUIRE_FALSE(lod.apply_update());
+    REQUIRE(lod.max_active_bin() == channel.extent(1) - 1);
+
+    // Copies & moves keep the requested and the active level
+    auto copy = lod;
+    copy.set_level(2);
+    lod = std::move(copy);
+    REQUIRE(lod.level() == 2);
+    REQUIRE(lod.max_active_bin() == channel.extent(1) - 1);
+    lod.set_level(1);
+    REQUIRE_FALSE(lod.apply_update());
+
+    lod(fdl.to_mdspan(), 0, accumulator.to_mdspan());
+    for (auto col = std::size_t(0); col < channel.extent(1); ++col) {
+        CAPTURE(col);
+        REQUIRE(accumulator(col) == (col < 32 ? Complex{} : channel(0, col)));
+    }
+
+    lod.set_level(2);
+    REQUIRE(lod.apply_update());
+    lod(fdl.to_mdspan(), 1, accumulator.to_mdspan());
+    REQUIRE(accumulator(0) == Complex{});
+}
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/bit/bit_ceil.hpp>
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/convolution/sparsity_budget.hpp>
+#include <neo/fft/rfftfreq.hpp>
+#include <neo/math/abs.hpp>
+#include <neo/math/absolute_threshold_of_hearing.hpp>
+#include <neo/unit/bark.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace neo::convolution {
+
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+struct masking_options
+{
+    double sample_rate{44'100.0};
+
+    /// Playback level of the loudest filter bin in dB SPL, aligns the filter with the threshold in quiet.
+    Float reference_level{96};
+
+    /// Distance of the masking threshold below the spread band energy in dB.
+    Float masking_offset{6};
+};
+
+/// \brief Schroeder spreading function in dB for a masker \p dz Bark below the maskee.
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+[[nodiscard]] auto spreading_function(Float dz) noexcept -> Float
+{
+    auto const x = dz + Float(0.474);
+    return Float(15.81) + Float(7.5) * x - Float(17.5) * std::sqrt(Float(1) + x * x);
+}
+
+/// \brief Per bin simultaneous masking threshold of each partition.
+///
+/// The filter is a partitions x bins matrix of rfft coefficients. Bins are
+/// grouped into one Bark wide critical bands, the band energies are spread
+/// across bands with the Schroeder spreading function and lowered by the
+/// masking offset. The result is the maximum of this and the absolute
+/// threshold of hearing. Everything is in dB relative to the loudest bin of
+/// the filter, so it can be compared to the bin powers directly.
+///
+/// \ingroup neo-convolution
+template<in_matrix InMat, std::floating_point Float = typename value_type_t<InMat>::value_type>
+    requires complex<value_type_t<InMat>>
+[[nodiscard]] auto masking_threshold(InMat filter, masking_options<Float> const& options)
+    -> stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>
+{
+    auto const num_partitions = static_cast<std::size_t>(filter.extent(0));
+    auto const num_bins       = static_cast<std::size_t>(filter.extent(1));
+    auto const size           = bit_ceil((num_bins - 1U) * 2U);
+    auto const inv_fs         = 1.0 / options.sample_rate;
+
+    auto threshold = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_partitions, num_bins};
+    if (num_partitions == 0 or num_bins == 0) {
+        return threshold;
+    }
+
+    auto const scale = detail::inverse_max_power<Float>(filter);
+
+    // Critical band & threshold in quiet of every bin, DC is treated as the first bin
+    auto band  = std::vector<std::size_t>(num_bins);
+    auto quiet = std::vector<Float>(num_bins);
+    for (auto bin = std::size_t(0); bin < num_bins; ++bin) {
+        auto const frequency = rfftfreq<Float>(size, std::max(bin, std::size_t(1)), inv_fs);
+        band[bin]            = static_cast<std::size_t>(std::max(hertz_to_bark(frequency), Float(0)));
+        quiet[bin]           = absolute_threshold_of_hearing(frequency) - options.reference_level;
+    }
+    auto const num_bands = band.back() + 1U;
+
+    // Linear spreading gain from band j to band i
+    auto spread = std::vector<Float>(num_bands * num_bands);
+    for (auto i = std::size_t(0); i < num_bands; ++i) {
+        for (auto j = std::size_t(0); j < num_bands; ++j) {
+            auto const dz             = static_cast<Float>(i) - static_cast<Float>(j);
+            spread[i * num_bands + j] = std::pow(Float(10), spreading_function(dz) / Float(10));
+        }
+    }
+
+    auto energy = std::vector<Float>(num_bands);
+    auto masked = std::vector<Float>(num_bands);
+    for (auto p = std::size_t(0); p < num_partitions; ++p) {
+        std::fill(energy.begin(), energy.end(), Float(0));
+        for (auto bin = std::size_t(0); bin < num_bins; ++bin) {
+            auto const amplitude = static_cast<Float>(math::abs(filter(p, bin)));
+            energy[band[bin]] += amplitude * amplitude * scale;
+        }
+
+        for (auto i = std::size_t(0); i < num_bands; ++i) {
+            auto spread_energy = Float(0);
+            for (auto j = std::size_t(0); j < num_bands; ++j) {
+                spread_energy += energy[j] * spread[i * num_bands + j];
+            }
+
+            masked[i] = spread_energy > Float(0) ? Float(10) * std::log10(spread_energy) - options.masking_offset
+                                                 : -std::numeric_limits<Float>::infinity();
+        }
+
+        for (auto bin = std::size_t(0); bin < num_bins; ++bin) {
+            threshold(p, bin) = std::max(masked[band[bin]], quiet[bin]);
+        }
+    }
+
+    return threshold;
+}
+
+/// \brief Signal-to-mask ratio of a filter bin in dB.
+///
+/// Positive values are audible. Can be used as the importance of
+/// budget_sparsity or compared to a margin in a csr_matrix predicate.
+///
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+struct masking_importance
+{
+    template<in_matrix InMat>
+        requires complex<value_type_t<InMat>>
+    masking_importance(InMat filter, masking_options<Float> const& options)
+        : _threshold{masking_threshold(filter, options)}
+        , _scale{detail::inverse_max_power<Float>(filter)}
+    {}
+
+    template<std::integral Index, complex Complex>
+    [[nodiscard]] auto operator()(Index row, Index col, Complex value) const noexcept -> Float
+    {
+        auto const amplitude = static_cast<Float>(math::abs(value));
+        auto const power     = amplitude * amplitude * _scale;
+        auto const level = power > Float(0) ? Float(10) * std::log10(power) : -std::numeric_limits<Float>::infinity();
+        return level - _threshold(static_cast<std::size_t>(row), static_cast<std::size_t>(col));
+    }
+
+private:
+    stdex::mdarray<Float, stdex::dextents<std::size_t, 2>> _threshold;
+    Float _scale{1};
+};
+
+/// \brief Sparsity predicate that keeps every bin above the masking threshold.
+///
+/// \p margin_db shifts the decision, negative values keep bins slightly below
+/// the threshold as a safety margin.
+///
+/// \ingroup neo-convolution
+template<in_matrix InMat, std::floating_point Float = typename value_type_t<InMat>::value_type>
+    requires complex<value_type_t<InMat>>
+[[nodiscard]] auto masking_sparsity(InMat filter, masking_options<Float> const& options, Float margin_db = Float(0))
+{
+    return [importance = masking_importance<Float>{filter, options}, margin_db](auto row, auto col, auto const& value) {
+        return importance(row, col, value) > margin_db;
+    };
+}
+
+}  // namespace neo::convolution
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+
+#include "masking_threshold.hpp"
+
+#include <neo/complex/scalar_complex.hpp>
+#include <neo/container/csr_matrix.hpp>
+#include <neo/testing/convolution.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <complex>
+
+TEMPLATE_TEST_CASE("neo/convolution: spreading_function", "", float, double)
+{
+    using Float = TestType;
+
+    REQUIRE(neo::convolution::spreading_function(Float(0)) == Catch::Approx(0.0).margin(0.01));
+
+    // Steeper towards lower bands
+    REQUIRE(neo::convolution::spreading_function(Float(-1)) < neo::convolution::spreading_function(Float(1)));
+    REQUIRE(neo::convolution::spreading_function(Float(2)) < neo::convolution::spreading_function(Float(1)));
+    REQUIRE(neo::convolution::spreading_function(Float(-2)) < neo::convolution::spreading_function(Float(-1)));
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: masking_threshold", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    // 1024 point rfft at 44.1 kHz, bin 23 is ~1 kHz, bin 300 is ~12.9 kHz
+    auto filter = stdex::mdarray<Complex, stdex::dextents<std::size_t, 2>>{2, 513};
+    filter(0, 23)  = Complex{1, 0};
+    filter(0, 24)  = Complex{Float(0.01), 0};
+    filter(0, 300) = Complex{Float(0.01), 0};
+    filter(1, 300) = Complex{Float(0.00001), 0};
+
+    auto const options   = neo::convolution::masking_options<Float>{.sample_rate = 44'100.0};
+    auto const threshold = neo::convolution::masking_threshold(filter.to_mdspan(), options);
+    REQUIRE(threshold.extent(0) == 2);
+    REQUIRE(threshold.extent(1) == 513);
+
+    // Masker is 0 dB, threshold in its band is the masking offset below
+    REQUIRE(threshold(0, 23) == Catch::Approx(-6.0).margin(0.5));
+
+    auto const importance = neo::convolution::masking_importance<Float>{filter.to_mdspan(), options};
+    REQUIRE(importance(0UL, 23UL, filter(0, 23)) > 0);   // masker
+    REQUIRE(importance(0UL, 24UL, filter(0, 24)) < 0);   // masked by the neighbour
+    REQUIRE(importance(0UL, 300UL, filter(0, 300)) > 0); // far away, above the threshold in quiet
+    REQUIRE(importance(1UL, 300UL, filter(1, 300)) < 0); // below the threshold in quiet
+
+    auto const sparsity = neo::convolution::masking_sparsity(filter.to_mdspan(), options);
+    auto const matrix   = neo::csr_matrix<Complex>{filter.to_mdspan(), sparsity};
+    REQUIRE(matrix.value_container().size() == 2);
+    REQUIRE(matrix(0, 23) == filter(0, 23));
+    REQUIRE(matrix(0, 300) == filter(0, 300));
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: masking_importance(scalar_complex)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const filter  = neo::generate_noise_filter<Float>(1024, 128, Catch::getSeed());
+    auto const channel = filter.to_mdspan();
+
+    auto scalar = stdex::mdarray<neo::scalar_complex<Float>, stdex::dextents<std::size_t, 2>>{
+        channel.extent(0),
+        channel.extent(1),
+    };
+    for (auto row = std::size_t(0); row < channel.extent(0); ++row) {
+        for (auto col = std::size_t(0); col < channel.extent(1); ++col) {
+            scalar(row, col) = neo::scalar_complex<Float>{channel(row, col).real(), channel(row, col).imag()};
+        }
+    }
+
+    auto const options    = neo::convolution::masking_options<Float>{.sample_rate = 44'100.0};
+    auto const expected   = neo::convolution::masking_importance<Float>{channel, options};
+    auto const importance = neo::convolution::masking_importance<Float>{scalar.to_mdspan(), options};
+    for (auto row = std::size_t(0); row < channel.extent(0); ++row) {
+        for (auto col = std::size_t(0); col < channel.extent(1); ++col) {
+            auto const score = expected(row, col, channel(row, col));
+            REQUIRE(importance(row, col, scalar(row, col)) == Catch::Approx(score).margin(1e-3));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: masking_sparsity", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const filter  = neo::generate_noise_filter<Float>(4096, 256, Catch::getSeed());
+    auto const channel = filter.to_mdspan();
+
+    auto const options = neo::convolution::masking_options<Float>{.sample_rate = 44'100.0};
+    auto const strict  = neo::csr_matrix<Complex>{channel, neo::convolution::masking_sparsity(channel, options)};
+    auto const loose   = neo::csr_matrix<Complex>{
+        channel,
+        neo::convolution::masking_sparsity(channel, options, Float(-20)),
+    };
+
+    auto const num_bins = channel.extent(0) * channel.extent(1);
+    REQUIRE(strict.value_container().size() > 0);
+    REQUIRE(strict.value_container().size() < num_bins);
+    REQUIRE(strict.value_container().size() <= loose.value_container().size());
+}
@@ -10,17 +10,27 @@
 #include <neo/algorithm/scale.hpp>
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
+#include <neo/convolution/ifft_scaling.hpp>
 #include <neo/convolution/mode.hpp>
+#include <neo/fft/pruned_rfft.hpp>
 #include <neo/fft/rfft.hpp>
+#include <neo/fft/split_rfft.hpp>
 #include <neo/math/idiv.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
+#include <type_traits>
 
 namespace neo::convolution {
 
+/// \brief Overlap-add with a real FFT.
+///
+/// If the callback returns the highest bin that may be non-zero and RealPlan has an
+/// inverse taking it, the bins above are skipped, see pruned_overlap_add.
+///
 /// \ingroup neo-convolution
-template<complex Complex>
+template<complex Complex, typename RealPlan = fft::rfft_plan<typename Complex::value_type, Complex>>
 struct overlap_add
 {
     using value_type   = Complex;
@@ -28,19 +38,23 @@ struct overlap_add
     using real_type    = typename Complex::value_type;
     using size_type    = std::size_t;
 
-    overlap_add(size_type block_size, size_type filter_size);
+    /// With ifft_scaling::filter the output is not normalized, the filter applied
+    /// by the callback has to be prescaled by 1 / transform_size().
+    overlap_add(size_type block_size, size_type filter_size, ifft_scaling scaling = ifft_scaling::output);
 
     [[nodiscard]] auto block_size() const noexcept -> size_type;
     [[nodiscard]] auto filter_size() const noexcept -> size_type;
     [[nodiscard]] auto transform_size() const noexcept -> size_type;
+    [[nodiscard]] auto scaling() const noexcept -> ifft_scaling;
 
     auto operator()(inout_vector auto block, auto callback) -> void;
 
 private:
     size_type _block_size;
     size_type _filter_size;
+    ifft_scaling _scaling;
 
-    fft::rfft_plan<real_type, complex_type> _rfft{
+    RealPlan _rfft{
         fft::from_order,
         fft::next_order(output_size<mode::full>(_block_size, _filter_size)),
     };
@@ -50,32 +64,39 @@ private:
     stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _overlap{_block_size};
 };
 
-template<complex Complex>
-overlap_add<Complex>::overlap_add(size_type block_size, size_type filter_size)
+template<complex Complex, typename RealPlan>
+overlap_add<Complex, RealPlan>::overlap_add(size_type block_size, size_type filter_size, ifft_scaling scaling)
     : _block_size{block_size}
     , _filter_size{filter_size}
+    , _scaling{scaling}
 {}
 
-template<complex Complex>
-auto overlap_add<Complex>::block_size() const noexcept -> size_type
+template<complex Complex, typename RealPlan>
+auto overlap_add<Complex, RealPlan>::block_size() const noexcept -> size_type
 {
     return _block_size;
 }
 
-template<complex Complex>
-auto overlap_add<Complex>::filter_size() const noexcept -> size_type
+template<complex Complex, typename RealPlan>
+auto overlap_add<Complex, RealPlan>::filter_size() const noexcept -> size_type
 {
     return _filter_size;
 }
 
-template<complex Complex>
-auto overlap_add<Complex>::transform_size() const noexcept -> size_type
+template<complex Complex, typename RealPlan>
+auto overlap_add<Complex, RealPlan>::transform_size() const noexcept -> size_type
 {
     return _rfft.size();
 }
 
-template<complex Complex>
-auto overlap_add<Complex>::operator()(inout_vector auto block, auto callback) -> void
+template<complex Complex, typename RealPlan>
+auto overlap_add<Complex, RealPlan>::scaling() const noexcept -> ifft_scaling
+{
+    return _scaling;
+}
+
+template<complex Complex, typename RealPlan>
+auto overlap_add<Complex, RealPlan>::operator()(inout_vector auto block, auto callback) -> void
 {
     assert(block.extent(0) == block_size());
 
@@ -92,12 +113,22 @@ auto overlap_add<Complex>::operator()(inout_vector auto block, auto callback) ->
     // K-point rfft
     rfft(_rfft, window, spectrum);
 
-    // Convolve
-    callback(spectrum);
-
-    // K-point irfft
-    irfft(_rfft, spectrum, window);
-    scale(1.0F / static_cast<real_type>(_rfft.size()), window);
+    // Convolve, K-point irfft
+    if constexpr (std::is_void_v<decltype(callback(spectrum))>) {
+        callback(spectrum);
+        irfft(_rfft, spectrum, window);
+    } else {
+        // Callback returned the highest bin that may be non-zero
+        auto const max_bin = static_cast<size_type>(callback(spectrum));
+        if constexpr (requires { _rfft(spectrum, window, max_bin); }) {
+            _rfft(spectrum, window, max_bin);
+        } else {
+            irfft(_rfft, spectrum, window);
+        }
+    }
+    if (_scaling == ifft_scaling::output) {
+        scale(1.0F / static_cast<real_type>(_rfft.size()), window);
+    }
 
     // Copy to output
     add(signal, overlap, block);
@@ -106,4 +137,113 @@ auto overlap_add<Complex>::operator()(inout_vector auto block, auto callback) ->
     copy(padding, overlap);
 }
 
+/// \brief Overlap-add whose inverse transform skips the bins above the max bin returned by the callback.
+///
+/// The pruned plan keeps a set of smaller transforms, only worth it for filters with a max_active_bin.
+///
+/// \ingroup neo-convolution
+template<complex Complex>
+using pruned_overlap_add = overlap_add<Complex, fft::pruned_rfft_plan<typename Complex::value_type, Complex>>;
+
+/// \brief Overlap-add with a split-complex spectrum, see split_overlap_save.
+/// \ingroup neo-convolution
+template<complex Complex>
+struct split_overlap_add
+{
+    using value_type   = Complex;
+    using complex_type = Complex;
+    using real_type    = typename Complex::value_type;
+    using size_type    = std::size_t;
+
+    split_overlap_add(size_type block_size, size_type filter_size, ifft_scaling scaling = ifft_scaling::output);
+
+    [[nodiscard]] auto block_size() const noexcept -> size_type;
+    [[nodiscard]] auto filter_size() const noexcept -> size_type;
+    [[nodiscard]] auto transform_size() const noexcept -> size_type;
+    [[nodiscard]] auto scaling() const noexcept -> ifft_scaling;
+
+    auto operator()(inout_vector auto block, auto callback) -> void;
+
+private:
+    size_type _block_size;
+    size_type _filter_size;
+    ifft_scaling _scaling;
+
+    fft::split_rfft_plan<real_type> _rfft{
+        fft::from_order,
+        fft::next_order(std::max(output_size<mode::full>(_block_size, _filter_size), size_type(4))),
+    };
+
+    stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _window{_rfft.size()};
+    stdex::mdarray<real_type, stdex::dextents<size_t, 2>> _spectrum{2, _rfft.size() / 2 + 1};
+    stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _overlap{_block_size};
+};
+
+template<complex Complex>
+split_overlap_add<Complex>::split_overlap_add(size_type block_size, size_type filter_size, ifft_scaling scaling)
+    : _block_size{block_size}
+    , _filter_size{filter_size}
+    , _scaling{scaling}
+{}
+
+template<complex Complex>
+auto split_overlap_add<Complex>::block_size() const noexcept -> size_type
+{
+    return _block_size;
+}
+
+template<complex Complex>
+auto split_overlap_add<Complex>::filter_size() const noexcept -> size_type
+{
+    return _filter_size;
+}
+
+template<complex Complex>
+auto split_overlap_add<Complex>::transform_size() const noexcept -> size_type
+{
+    return _rfft.size();
+}
+
+template<complex Complex>
+auto split_overlap_add<Complex>::scaling() const noexcept -> ifft_scaling
+{
+    return _scaling;
+}
+
+template<complex Complex>
+auto split_overlap_add<Complex>::operator()(inout_vector auto block, auto callback) -> void
+{
+    assert(block.extent(0) == block_size());
+
+    auto const window   = _window.to_mdspan();
+    auto const signal   = stdex::submdspan(window, std::tuple{0, block_size()});
+    auto const padding  = stdex::submdspan(window, std::tuple{block_size(), block_size() * 2U});
+    auto const overlap  = _overlap.to_mdspan();
+    auto const spectrum = split_complex{
+        stdex::submdspan(_spectrum.to_mdspan(), 0, stdex::full_extent),
+        stdex::submdspan(_spectrum.to_mdspan(), 1, stdex::full_extent),
+    };
+
+    copy(block, signal);
+    fill(padding, real_type(0));
+
+    rfft(_rfft, window, spectrum);
+
+    if constexpr (std::is_void_v<decltype(callback(spectrum))>) {
+        callback(spectrum);
+        irfft(_rfft, spectrum, window);
+    } else {
+        // Callback returned the highest bin that may be non-zero
+        auto const max_bin = static_cast<size_type>(callback(spectrum));
+        _rfft(spectrum, window, max_bin);
+    }
+
+    if (_scaling == ifft_scaling::output) {
+        scale(real_type(1) / static_cast<real_type>(_rfft.size()), window);
+    }
+
+    add(signal, overlap, block);
+    copy(padding, overlap);
+}
+
 }  // namespace neo::convolution
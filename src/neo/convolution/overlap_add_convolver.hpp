@@ -10,6 +10,7 @@
 #include <neo/algorithm/scale.hpp>
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
+#include <neo/convolution/ifft_scaling.hpp>
 #include <neo/fft/rfft.hpp>
 
 #include <cassert>
@@ -29,10 +30,16 @@ struct overlap_add_convolver
 
     overlap_add_convolver() = default;
 
+    /// With ifft_scaling::filter the 1/N of the inverse transform is folded into the filter.
+    explicit overlap_add_convolver(ifft_scaling scaling) noexcept;
+
+    [[nodiscard]] auto scaling() const noexcept -> ifft_scaling;
+
     auto filter(in_matrix_of<Complex> auto f) -> void;
     auto operator()(inout_vector_of<real_type> auto inout) -> void;
 
 private:
+    ifft_scaling _scaling{ifft_scaling::output};
     size_type _block_size{2};
     size_type _num_segments{0};
     size_type _input_pos{0};
@@ -51,6 +58,16 @@ private:
     accumulator_type _tmp_accumulator;
 };
 
+template<complex Complex, typename Fdl, typename Filter>
+overlap_add_convolver<Complex, Fdl, Filter>::overlap_add_convolver(ifft_scaling scaling) noexcept : _scaling{scaling}
+{}
+
+template<complex Complex, typename Fdl, typename Filter>
+auto overlap_add_convolver<Complex, Fdl, Filter>::scaling() const noexcept -> ifft_scaling
+{
+    return _scaling;
+}
+
 template<complex Complex, typename Fdl, typename Filter>
 auto overlap_add_convolver<Complex, Fdl, Filter>::filter(in_matrix_of<Complex> auto f) -> void
 {
@@ -65,7 +82,12 @@ auto overlap_add_convolver<Complex, Fdl, Filter>::filter(in_matrix_of<Complex> a
     _fdl             = Fdl{f.extents()};
     _accumulator     = accumulator_type{f.extent(1)};
     _tmp_accumulator = accumulator_type{f.extent(1)};
-    _filter.filter(f);
+
+    if (_scaling == ifft_scaling::filter) {
+        _filter.filter(detail::prescale_filter(f, _rfft.size()).to_mdspan());
+    } else {
+        _filter.filter(f);
+    }
 }
 
 template<complex Complex, typename Fdl, typename Filter>
@@ -112,7 +134,9 @@ auto overlap_add_convolver<Complex, Fdl, Filter>::operator()(inout_vector_of<rea
         copy(accumulator, complex_window);
 
         irfft(_rfft, complex_window, real_window);
-        scale(real_type(1) / static_cast<real_type>(_rfft.size()), real_window);
+        if (_scaling == ifft_scaling::output) {
+            scale(real_type(1) / static_cast<real_type>(_rfft.size()), real_window);
+        }
 
         auto sub_overlap = stdex::submdspan(overlap, std::tuple{_input_pos, _input_pos + num_to_process});
         add(sub_window, sub_overlap, sub_inout);
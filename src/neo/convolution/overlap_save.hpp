@@ -9,15 +9,25 @@
 #include <neo/algorithm/scale.hpp>
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
+#include <neo/convolution/ifft_scaling.hpp>
 #include <neo/fft.hpp>
+#include <neo/fft/pruned_rfft.hpp>
+#include <neo/fft/split_rfft.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
+#include <type_traits>
 
 namespace neo::convolution {
 
+/// \brief Overlap-save with a real FFT.
+///
+/// If the callback returns the highest bin that may be non-zero and RealPlan has an
+/// inverse taking it, the bins above are skipped, see pruned_overlap_save.
+///
 /// \ingroup neo-convolution
-template<complex Complex>
+template<complex Complex, typename RealPlan = fft::rfft_plan<typename Complex::value_type, Complex>>
 struct overlap_save
 {
     using value_type   = Complex;
@@ -25,11 +35,14 @@ struct overlap_save
     using real_type    = typename Complex::value_type;
     using size_type    = std::size_t;
 
-    overlap_save(size_type block_size, size_type filter_size);
+    /// With ifft_scaling::filter the output is not normalized, the filter applied
+    /// by the callback has to be prescaled by 1 / transform_size().
+    overlap_save(size_type block_size, size_type filter_size, ifft_scaling scaling = ifft_scaling::output);
 
     [[nodiscard]] auto block_size() const noexcept -> size_type;
     [[nodiscard]] auto filter_size() const noexcept -> size_type;
     [[nodiscard]] auto transform_size() const noexcept -> size_type;
+    [[nodiscard]] auto scaling() const noexcept -> ifft_scaling;
 
     auto operator()(inout_vector auto block, auto callback) -> void;
 
@@ -50,39 +63,47 @@ private:
 
     size_type _block_size;
     size_type _filter_size;
-    fft::rfft_plan<real_type, complex_type> _plan{fft::from_order, fft::next_order(_block_size + _filter_size - 1UL)};
+    ifft_scaling _scaling;
+    RealPlan _plan{fft::from_order, fft::next_order(_block_size + _filter_size - 1UL)};
 
     stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _window{_plan.size()};
     stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _real_buffer{_plan.size()};
     stdex::mdarray<complex_type, stdex::dextents<size_t, 1>> _complex_buffer{_plan.size()};
 };
 
-template<complex Complex>
-overlap_save<Complex>::overlap_save(size_type block_size, size_type filter_size)
+template<complex Complex, typename RealPlan>
+overlap_save<Complex, RealPlan>::overlap_save(size_type block_size, size_type filter_size, ifft_scaling scaling)
     : _block_size{block_size}
     , _filter_size{filter_size}
+    , _scaling{scaling}
 {}
 
-template<complex Complex>
-auto overlap_save<Complex>::block_size() const noexcept -> size_type
+template<complex Complex, typename RealPlan>
+auto overlap_save<Complex, RealPlan>::block_size() const noexcept -> size_type
 {
     return _block_size;
 }
 
-template<complex Complex>
-auto overlap_save<Complex>::filter_size() const noexcept -> size_type
+template<complex Complex, typename RealPlan>
+auto overlap_save<Complex, RealPlan>::filter_size() const noexcept -> size_type
 {
     return _filter_size;
 }
 
-template<complex Complex>
-auto overlap_save<Complex>::transform_size() const noexcept -> size_type
+template<complex Complex, typename RealPlan>
+auto overlap_save<Complex, RealPlan>::transform_size() const noexcept -> size_type
 {
     return _plan.size();
 }
 
-template<complex Complex>
-auto overlap_save<Complex>::operator()(inout_vector auto block, auto callback) -> void
+template<complex Complex, typename RealPlan>
+auto overlap_save<Complex, RealPlan>::scaling() const noexcept -> ifft_scaling
+{
+    return _scaling;
+}
+
+template<complex Complex, typename RealPlan>
+auto overlap_save<Complex, RealPlan>::operator()(inout_vector auto block, auto callback) -> void
 {
     assert(block.extent(0) == block_size());
 
@@ -98,17 +119,140 @@ auto overlap_save<Complex>::operator()(inout_vector auto block, auto callback) -
     auto const complex_buf = _complex_buffer.to_mdspan();
     rfft(_plan, window, complex_buf);
 
-    // Apply processing
-    auto const coeffs = stdex::submdspan(complex_buf, std::tuple{0, _plan.size() / 2 + 1});
-    callback(coeffs);
-
-    // 2B-point C2R-IFFT
+    // Apply processing & 2B-point C2R-IFFT
+    auto const coeffs   = stdex::submdspan(complex_buf, std::tuple{0, _plan.size() / 2 + 1});
     auto const real_buf = _real_buffer.to_mdspan();
-    irfft(_plan, complex_buf, real_buf);
-    scale(1.0F / static_cast<real_type>(_plan.size()), real_buf);
+    if constexpr (std::is_void_v<decltype(callback(coeffs))>) {
+        callback(coeffs);
+        irfft(_plan, complex_buf, real_buf);
+    } else {
+        // Callback returned the highest bin that may be non-zero
+        auto const max_bin = static_cast<size_type>(callback(coeffs));
+        if constexpr (requires { _plan(coeffs, real_buf, max_bin); }) {
+            _plan(coeffs, real_buf, max_bin);
+        } else {
+            irfft(_plan, complex_buf, real_buf);
+        }
+    }
+    if (_scaling == ifft_scaling::output) {
+        scale(1.0F / static_cast<real_type>(_plan.size()), real_buf);
+    }
 
     // Copy block_size samples to output
     copy(stdex::submdspan(real_buf, keep_extents), block);
 }
 
+/// \brief Overlap-save whose inverse transform skips the bins above the max bin returned by the callback.
+///
+/// The pruned plan keeps a set of smaller transforms, only worth it for filters with a max_active_bin.
+///
+/// \ingroup neo-convolution
+template<complex Complex>
+using pruned_overlap_save = overlap_save<Complex, fft::pruned_rfft_plan<typename Complex::value_type, Complex>>;
+
+/// \brief Overlap-save with a split-complex spectrum.
+///
+/// The callback receives a split_complex of the real & imaginary rows, so split
+/// FDLs and filters work without interleaving the spectrum every block.
+///
+/// \ingroup neo-convolution
+template<complex Complex>
+struct split_overlap_save
+{
+    using value_type   = Complex;
+    using complex_type = Complex;
+    using real_type    = typename Complex::value_type;
+    using size_type    = std::size_t;
+
+    split_overlap_save(size_type block_size, size_type filter_size, ifft_scaling scaling = ifft_scaling::output);
+
+    [[nodiscard]] auto block_size() const noexcept -> size_type;
+    [[nodiscard]] auto filter_size() const noexcept -> size_type;
+    [[nodiscard]] auto transform_size() const noexcept -> size_type;
+    [[nodiscard]] auto scaling() const noexcept -> ifft_scaling;
+
+    auto operator()(inout_vector auto block, auto callback) -> void;
+
+private:
+    size_type _block_size;
+    size_type _filter_size;
+    ifft_scaling _scaling;
+    fft::split_rfft_plan<real_type> _plan{
+        fft::from_order,
+        fft::next_order(std::max(_block_size + _filter_size - 1UL, size_type(4))),
+    };
+
+    stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _window{_plan.size()};
+    stdex::mdarray<real_type, stdex::dextents<size_t, 1>> _real_buffer{_plan.size()};
+    stdex::mdarray<real_type, stdex::dextents<size_t, 2>> _spectrum{2, _plan.size() / 2 + 1};
+};
+
+template<complex Complex>
+split_overlap_save<Complex>::split_overlap_save(size_type block_size, size_type filter_size, ifft_scaling scaling)
+    : _block_size{block_size}
+    , _filter_size{filter_size}
+    , _scaling{scaling}
+{}
+
+template<complex Complex>
+auto split_overlap_save<Complex>::block_size() const noexcept -> size_type
+{
+    return _block_size;
+}
+
+template<complex Complex>
+auto split_overlap_save<Complex>::filter_size() const noexcept -> size_type
+{
+    return _filter_size;
+}
+
+template<complex Complex>
+auto split_overlap_save<Complex>::transform_size() const noexcept -> size_type
+{
+    return _plan.size();
+}
+
+template<complex Complex>
+auto split_overlap_save<Complex>::scaling() const noexcept -> ifft_scaling
+{
+    return _scaling;
+}
+
+template<complex Complex>
+auto split_overlap_save<Complex>::operator()(inout_vector auto block, auto callback) -> void
+{
+    assert(block.extent(0) == block_size());
+
+    auto const size     = transform_size();
+    auto const window   = _window.to_mdspan();
+    auto const keep     = std::tuple{size - block_size(), size};
+    auto const real_buf = _real_buffer.to_mdspan();
+    auto const spectrum = split_complex{
+        stdex::submdspan(_spectrum.to_mdspan(), 0, stdex::full_extent),
+        stdex::submdspan(_spectrum.to_mdspan(), 1, stdex::full_extent),
+    };
+
+    // Slide the window by one block, the ranges overlap but the copy runs forward
+    for (auto i = size_type(0); i < size - block_size(); ++i) {
+        window[i] = window[i + block_size()];
+    }
+    copy(block, stdex::submdspan(window, keep));
+
+    rfft(_plan, window, spectrum);
+
+    if constexpr (std::is_void_v<decltype(callback(spectrum))>) {
+        callback(spectrum);
+        irfft(_plan, spectrum, real_buf);
+    } else {
+        // Callback returned the highest bin that may be non-zero
+        auto const max_bin = static_cast<size_type>(callback(spectrum));
+        _plan(spectrum, real_buf, max_bin);
+    }
+
+    if (_scaling == ifft_scaling::output) {
+        scale(real_type(1) / static_cast<real_type>(size), stdex::submdspan(real_buf, keep));
+    }
+    copy(stdex::submdspan(real_buf, keep), block);
+}
+
 }  // namespace neo::convolution
@@ -36,8 +36,13 @@ static auto test_overlap() -> void
 
     for (std::size_t i{0}; i < output.size(); i += block_size) {
         auto block = stdex::submdspan(blocks, std::tuple{i, i + block_size});
-        overlap(block, [&](neo::inout_vector auto io) {
-            REQUIRE(io.extent(0) == overlap.transform_size() / 2UL + 1UL);
+        overlap(block, [&](auto io) {
+            if constexpr (requires { io.real, io.imag; }) {
+                REQUIRE(io.real.extent(0) == overlap.transform_size() / 2UL + 1UL);
+                REQUIRE(io.imag.extent(0) == overlap.transform_size() / 2UL + 1UL);
+            } else {
+                REQUIRE(io.extent(0) == overlap.transform_size() / 2UL + 1UL);
+            }
         });
     }
 
@@ -56,7 +61,10 @@ static auto test_overlap() -> void
 TEMPLATE_PRODUCT_TEST_CASE(
     "neo/convolution:",
     "",
-    (neo::convolution::overlap_add, neo::convolution::overlap_save),
+    (neo::convolution::overlap_add,
+     neo::convolution::overlap_save,
+     neo::convolution::split_overlap_add,
+     neo::convolution::split_overlap_save),
     (std::complex<float>, std::complex<double>)
 )
 {
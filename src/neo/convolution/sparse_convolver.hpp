@@ -4,6 +4,7 @@
 
 #include <neo/complex.hpp>
 #include <neo/convolution/dense_fdl.hpp>
+#include <neo/convolution/lod_filter.hpp>
 #include <neo/convolution/overlap_add.hpp>
 #include <neo/convolution/overlap_save.hpp>
 #include <neo/convolution/sparse_filter.hpp>
@@ -14,11 +15,21 @@ namespace neo::convolution {
 /// \ingroup neo-convolution
 template<complex Complex>
 using sparse_upols_convolver
-    = uniform_partitioned_convolver<overlap_save<Complex>, dense_fdl<Complex>, sparse_filter<Complex>>;
+    = uniform_partitioned_convolver<pruned_overlap_save<Complex>, dense_fdl<Complex>, sparse_filter<Complex>>;
 
 /// \ingroup neo-convolution
 template<complex Complex>
 using sparse_upola_convolver
-    = uniform_partitioned_convolver<overlap_add<Complex>, dense_fdl<Complex>, sparse_filter<Complex>>;
+    = uniform_partitioned_convolver<pruned_overlap_add<Complex>, dense_fdl<Complex>, sparse_filter<Complex>>;
+
+/// \ingroup neo-convolution
+template<complex Complex>
+using lod_upols_convolver
+    = uniform_partitioned_convolver<pruned_overlap_save<Complex>, dense_fdl<Complex>, lod_filter<Complex>>;
+
+/// \ingroup neo-convolution
+template<complex Complex>
+using lod_upola_convolver
+    = uniform_partitioned_convolver<pruned_overlap_add<Complex>, dense_fdl<Complex>, lod_filter<Complex>>;
 
 }  // namespace neo::convolution
@@ -5,9 +5,14 @@
 #include <neo/algorithm/multiply_add.hpp>
 #include <neo/complex.hpp>
 #include <neo/container/csr_matrix.hpp>
+#include <neo/container/csr_matrix_builder.hpp>
 #include <neo/container/mdspan.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
 #include <concepts>
+#include <utility>
 
 namespace neo::convolution {
 
@@ -21,12 +26,93 @@ struct sparse_filter
     using accumulator_type = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>;
 
     sparse_filter() = default;
+    ~sparse_filter() = default;
+
+    /// Copies & moves are not synchronized with update(), the pending filter is carried over.
+    /// The scratch storage for pruning is not copied.
+    sparse_filter(sparse_filter const& other)
+        : _filter{other._filter}
+        , _pending{other._pending}
+        , _max_active_bin{other._max_active_bin}
+        , _pending_max_active_bin{other._pending_max_active_bin}
+        , _has_update{other._has_update.load(std::memory_order_acquire)}
+    {}
+
+    sparse_filter(sparse_filter&& other) noexcept
+        : _filter{std::move(other._filter)}
+        , _pending{std::move(other._pending)}
+        , _max_active_bin{other._max_active_bin}
+        , _pending_max_active_bin{other._pending_max_active_bin}
+        , _has_update{other._has_update.exchange(false, std::memory_order_acq_rel)}
+        , _builder{std::move(other._builder)}
+    {}
+
+    auto operator=(sparse_filter const& other) -> sparse_filter& { return *this = sparse_filter{other}; }
+
+    auto operator=(sparse_filter&& other) noexcept -> sparse_filter&
+    {
+        _filter                 = std::move(other._filter);
+        _pending                = std::move(other._pending);
+        _max_active_bin         = other._max_active_bin;
+        _pending_max_active_bin = other._pending_max_active_bin;
+        _has_update.store(other._has_update.exchange(false, std::memory_order_acq_rel), std::memory_order_release);
+        _builder = std::move(other._builder);
+        return *this;
+    }
 
     auto filter(in_matrix_of<Complex> auto input, auto sparsity) -> void
     {
-        _filter = csr_matrix<Complex>{input, sparsity};
+        _filter         = prune(input, sparsity);
+        _max_active_bin = max_column(_filter);
+        _pending        = storage_type{};
+        _has_update.store(false, std::memory_order_relaxed);
+    }
+
+    /// \brief Hands a re-pruned filter with the same extents over to operator().
+    ///
+    /// Meant for a single background thread, the matrix is built and the last
+    /// replaced filter is freed here. The new filter takes effect at the next
+    /// apply_update(). Returns false if the previous update is still pending.
+    /// Re-pruning is a single row-major pass that reuses the triplet storage of
+    /// the previous call, no dense mask is allocated.
+    auto update(in_matrix_of<Complex> auto input, auto sparsity) -> bool
+    {
+        if (_has_update.load(std::memory_order_acquire)) {
+            return false;
+        }
+        return update(prune(input, sparsity));
+    }
+
+    auto update(storage_type filter) -> bool
+    {
+        assert(filter.extents() == _filter.extents());
+
+        if (_has_update.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        _pending_max_active_bin = max_column(filter);
+        _pending                = std::move(filter);
+        _has_update.store(true, std::memory_order_release);
+        return true;
     }
 
+    /// Swaps in a pending update, never allocates or frees. Call at a block boundary.
+    auto apply_update() noexcept -> bool
+    {
+        if (not _has_update.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        std::swap(_filter, _pending);
+        std::swap(_max_active_bin, _pending_max_active_bin);
+        _has_update.store(false, std::memory_order_release);
+        return true;
+    }
+
+    /// Highest column with a coefficient, every bin above stays zero in the accumulator.
+    [[nodiscard]] auto max_active_bin() const noexcept -> index_type { return _max_active_bin; }
+
     template<in_vector_of<Complex> FdlRow, std::integral Index, inout_vector_of<Complex> Accumulator>
     auto operator()(FdlRow fdl, Index filter_index, Accumulator accumulator) -> void
     {
@@ -34,7 +120,46 @@ struct sparse_filter
     }
 
 private:
+    /// sparsity is a predicate (row, col, value) or a mask with a non-zero entry for every kept element.
+    [[nodiscard]] auto prune(in_matrix_of<Complex> auto input, auto sparsity) -> storage_type
+    {
+        auto const rows = static_cast<std::size_t>(input.extent(0));
+        auto const cols = static_cast<std::size_t>(input.extent(1));
+        if (_builder.rows() != rows or _builder.columns() != cols) {
+            _builder = csr_matrix_builder<Complex, index_type>{rows, cols};
+        }
+
+        for (auto row = std::size_t(0); row < rows; ++row) {
+            for (auto col = std::size_t(0); col < cols; ++col) {
+                auto const value = Complex(input(row, col));
+                if constexpr (std::predicate<decltype(sparsity), index_type, index_type, Complex>) {
+                    if (not sparsity(row, col, value)) {
+                        continue;
+                    }
+                } else {
+                    if (sparsity(row, col) == 0) {
+                        continue;
+                    }
+                }
+                _builder.push_back(row, col, value);
+            }
+        }
+
+        return _builder.finalize();
+    }
+
+    [[nodiscard]] static auto max_column(storage_type const& filter) noexcept -> index_type
+    {
+        auto const& columns = filter.column_container();
+        return columns.empty() ? index_type(0) : *std::max_element(columns.begin(), columns.end());
+    }
+
     csr_matrix<Complex> _filter;
+    csr_matrix<Complex> _pending;
+    index_type _max_active_bin{0};
+    index_type _pending_max_active_bin{0};
+    std::atomic<bool> _has_update{false};
+    csr_matrix_builder<Complex, index_type> _builder{0, 0};
 };
 
 }  // namespace neo::convolution
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/bit/bit_ceil.hpp>
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fft/rfftfreq.hpp>
+#include <neo/math/a_weighting.hpp>
+#include <neo/math/abs.hpp>
+#include <neo/unit/decibel.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace neo::convolution {
+
+namespace detail {
+
+/// 1 / the power of the loudest bin, or 1 for a silent filter.
+template<std::floating_point Float, in_matrix InMat>
+[[nodiscard]] auto inverse_max_power(InMat filter) -> Float
+{
+    auto max_power = Float(0);
+    for (auto row = std::size_t(0); row < static_cast<std::size_t>(filter.extent(0)); ++row) {
+        for (auto col = std::size_t(0); col < static_cast<std::size_t>(filter.extent(1)); ++col) {
+            auto const amplitude = static_cast<Float>(math::abs(filter(row, col)));
+            max_power            = std::max(max_power, amplitude * amplitude);
+        }
+    }
+    return max_power > Float(0) ? Float(1) / max_power : Float(1);
+}
+
+}  // namespace detail
+
+/// \brief Perceptual importance of a filter bin in dB.
+///
+/// Power of the bin relative to the loudest bin of the filter, plus the
+/// A-weighting of its frequency. The lowest bins can be pinned, they are
+/// always kept.
+///
+/// \ingroup neo-convolution
+template<std::floating_point Float>
+struct a_weighted_importance
+{
+    template<in_matrix InMat>
+        requires complex<value_type_t<InMat>>
+    a_weighted_importance(InMat filter, double sample_rate, std::size_t low_bins_to_keep = 0);
+
+    template<std::integral Index, complex Complex>
+    [[nodiscard]] auto operator()(Index row, Index col, Complex value) const noexcept -> Float;
+
+    /// \brief Linear power per column, above which the importance exceeds \p threshold.
+    ///
+    /// Turns the log-domain comparison into a plain power comparison for sparsity_mask.
+    /// Columns that are kept regardless of their power get a negative threshold.
+    [[nodiscard]] auto power_thresholds(Float threshold) const -> stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>;
+
+private:
+    Float _scale{1};
+    std::vector<Float> _weights;
+};
+
+template<std::floating_point Float>
+template<in_matrix InMat>
+    requires complex<value_type_t<InMat>>
+a_weighted_importance<Float>::a_weighted_importance(InMat filter, double sample_rate, std::size_t low_bins_to_keep)
+    : _scale{detail::inverse_max_power<Float>(filter)}
+    , _weights(static_cast<std::size_t>(filter.extent(1)))
+{
+    auto const num_bins = static_cast<std::size_t>(filter.extent(1));
+    auto const size     = bit_ceil((num_bins - 1U) * 2U);
+    assert(low_bins_to_keep <= num_bins);
+
+    for (auto col = std::size_t(0); col < num_bins; ++col) {
+        if (col < low_bins_to_keep) {
+            _weights[col] = std::numeric_limits<Float>::infinity();
+        } else {
+            // a_weighting is undefined at DC, use the next bin instead
+            auto const frequency = rfftfreq<Float>(size, std::max(col, std::size_t(1)), 1.0 / sample_rate);
+            _weights[col]        = a_weighting(frequency);
+        }
+    }
+}
+
+template<std::floating_point Float>
+template<std::integral Index, complex Complex>
+auto a_weighted_importance<Float>::operator()(Index /*row*/, Index col, Complex value) const noexcept -> Float
+{
+    auto const amplitude = static_cast<Float>(math::abs(value));
+    auto const power     = amplitude * amplitude;
+    return amplitude_to_db(power * _scale) * Float(0.5) + _weights[static_cast<std::size_t>(col)];
+}
+
+template<std::floating_point Float>
+auto a_weighted_importance<Float>::power_thresholds(Float threshold) const
+    -> stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>
+{
+    // amplitude_to_db clamps at -144 dB, so the power half of the importance never drops below -72 dB
+    static constexpr auto const floor = Float(-72);
+
+    auto thresholds = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{_weights.size()};
+    for (auto col = std::size_t(0); col < _weights.size(); ++col) {
+        auto const level = threshold - _weights[col];
+        thresholds(col)  = level < floor ? Float(-1) : std::pow(Float(10), level / Float(10)) / _scale;
+    }
+    return thresholds;
+}
+
+/// \brief Converts a time budget per block into complex multiply-adds per block.
+///
+/// \p macs_per_second is the measured throughput of the sparse multiply-add
+/// on the target machine, e.g. from the multiply_add benchmark.
+///
+/// \ingroup neo-convolution
+template<typename Rep, typename Period>
+[[nodiscard]] auto mac_budget(std::chrono::duration<Rep, Period> time_per_block, double macs_per_second) noexcept
+    -> std::size_t
+{
+    auto const seconds = std::chrono::duration<double>{time_per_block}.count();
+    return static_cast<std::size_t>(std::max(seconds * macs_per_second, 0.0));
+}
+
+/// \brief Finds the lowest importance threshold that fits into the budget.
+///
+/// Every bin with importance(row, col, value) > threshold costs one complex
+/// multiply-add per block in a uniform partitioned convolver. The threshold is
+/// found by bisection over the scores, so that as many bins as possible are
+/// kept without exceeding \p max_macs. Bins with an infinite score are always
+/// kept, even if they alone exceed the budget.
+///
+/// \ingroup neo-convolution
+template<in_matrix InMat, typename Importance>
+[[nodiscard]] auto budget_threshold(InMat filter, Importance importance, std::size_t max_macs)
+{
+    using Score = std::decay_t<decltype(importance(std::size_t(0), std::size_t(0), filter(0, 0)))>;
+
+    auto const rows = static_cast<std::size_t>(filter.extent(0));
+    auto const cols = static_cast<std::size_t>(filter.extent(1));
+
+    auto scores = std::vector<Score>{};
+    scores.reserve(rows * cols);
+    for (auto row = std::size_t(0); row < rows; ++row) {
+        for (auto col = std::size_t(0); col < cols; ++col) {
+            scores.push_back(importance(row, col, filter(row, col)));
+        }
+    }
+
+    auto const count_above = [&scores](Score threshold) {
+        return static_cast<std::size_t>(std::count_if(scores.begin(), scores.end(), [threshold](Score score) {
+            return score > threshold;
+        }));
+    };
+
+    auto lo = std::numeric_limits<Score>::max();
+    auto hi = std::numeric_limits<Score>::lowest();
+    for (auto score : scores) {
+        if (std::isfinite(score)) {
+            lo = std::min(lo, score);
+            hi = std::max(hi, score);
+        }
+    }
+
+    // No finite scores, or everything fits
+    if (lo > hi) {
+        return std::numeric_limits<Score>::lowest();
+    }
+    lo = std::nextafter(lo, std::numeric_limits<Score>::lowest());
+    if (count_above(lo) <= max_macs) {
+        return lo;
+    }
+
+    // Invariant: count_above(lo) > max_macs and count_above(hi) <= max_macs
+    for (auto i = 0; i < 64; ++i) {
+        auto const mid = lo + (hi - lo) / Score(2);
+        if (mid <= lo or mid >= hi) {
+            break;
+        }
+
+        auto const count = count_above(mid);
+        if (count == max_macs) {
+            return mid;
+        }
+        if (count < max_macs) {
+            hi = mid;
+        } else {
+            lo = mid;
+        }
+    }
+
+    return hi;
+}
+
+/// \brief Sparsity predicate that keeps the most important bins within the budget.
+///
+/// The result can be passed to sparse_filter::filter or csr_matrix.
+///
+/// \ingroup neo-convolution
+template<in_matrix InMat, typename Importance>
+[[nodiscard]] auto budget_sparsity(InMat filter, Importance importance, std::size_t max_macs)
+{
+    auto const threshold = budget_threshold(filter, importance, max_macs);
+    return [importance = std::move(importance), threshold](auto row, auto col, auto const& value) {
+        return importance(row, col, value) > threshold;
+    };
+}
+
+}  // namespace neo::convolution
@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: MIT
+
+#include "sparsity_budget.hpp"
+
+#include <neo/algorithm/allclose.hpp>
+#include <neo/complex/scalar_complex.hpp>
+#include <neo/container/csr_matrix.hpp>
+#include <neo/convolution/sparse_convolver.hpp>
+#include <neo/testing/convolution.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <chrono>
+#include <complex>
+#include <concepts>
+#include <limits>
+#include <tuple>
+
+TEST_CASE("neo/convolution: mac_budget")
+{
+    using namespace std::chrono_literals;
+
+    REQUIRE(neo::convolution::mac_budget(1ms, 1e9) == 1'000'000);
+    REQUIRE(neo::convolution::mac_budget(250us, 4e8) == 100'000);
+    REQUIRE(neo::convolution::mac_budget(0ms, 1e9) == 0);
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: budget_sparsity", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const filter  = neo::generate_noise_filter<Float>(4096, 256, Catch::getSeed());
+    auto const channel = filter.to_mdspan();
+
+    auto const num_bins = channel.extent(0) * channel.extent(1);
+    auto const budget   = GENERATE_COPY(as<std::size_t>{}, 0, 1, 100, 1000, num_bins / 2, num_bins, num_bins * 2);
+    CAPTURE(budget);
+
+    auto const importance = neo::convolution::a_weighted_importance<Float>{channel, 44'100.0};
+    auto const sparsity   = neo::convolution::budget_sparsity(channel, importance, budget);
+
+    auto const matrix = neo::csr_matrix<Complex>{channel, sparsity};
+    auto const nnz    = matrix.value_container().size();
+
+    // Scores of noise are unique, so the budget is hit exactly
+    REQUIRE(nnz == std::min(budget, num_bins));
+
+    auto convolver = neo::convolution::sparse_upola_convolver<Complex>{};
+    convolver.filter(channel, sparsity);
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: a_weighted_importance(scalar_complex)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const filter  = neo::generate_noise_filter<Float>(1024, 128, Catch::getSeed());
+    auto const channel = filter.to_mdspan();
+
+    auto scalar = stdex::mdarray<neo::scalar_complex<Float>, stdex::dextents<std::size_t, 2>>{
+        channel.extent(0),
+        channel.extent(1),
+    };
+    for (auto row = std::size_t(0); row < channel.extent(0); ++row) {
+        for (auto col = std::size_t(0); col < channel.extent(1); ++col) {
+            scalar(row, col) = neo::scalar_complex<Float>{channel(row, col).real(), channel(row, col).imag()};
+        }
+    }
+
+    auto const expected   = neo::convolution::a_weighted_importance<Float>{channel, 44'100.0, 2};
+    auto const importance = neo::convolution::a_weighted_importance<Float>{scalar.to_mdspan(), 44'100.0, 2};
+    for (auto row = std::size_t(0); row < channel.extent(0); ++row) {
+        for (auto col = std::size_t(0); col < channel.extent(1); ++col) {
+            REQUIRE(importance(row, col, scalar(row, col)) == Catch::Approx(expected(row, col, channel(row, col))));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: budget_threshold", "", float, double)
+{
+    using Float = TestType;
+
+    // Scores: row * 10 + col, low bins pinned
+    auto const filter     = stdex::mdarray<std::complex<Float>, stdex::dextents<std::size_t, 2>>{4, 8};
+    auto const importance = [](std::size_t row, std::size_t col, auto) {
+        if (col == 0) {
+            return std::numeric_limits<Float>::infinity();
+        }
+        return static_cast<Float>(row * 10 + col);
+    };
+
+    auto const count = [&](Float threshold) {
+        auto n = std::size_t(0);
+        for (auto row = std::size_t(0); row < 4; ++row) {
+            for (auto col = std::size_t(0); col < 8; ++col) {
+                n += static_cast<std::size_t>(importance(row, col, 0) > threshold);
+            }
+        }
+        return n;
+    };
+
+    auto const budget    = GENERATE(as<std::size_t>{}, 0, 4, 5, 17, 31, 32, 100);
+    auto const threshold = neo::convolution::budget_threshold(filter.to_mdspan(), importance, budget);
+    CAPTURE(budget);
+    CAPTURE(threshold);
+
+    // Pinned bins are always kept
+    REQUIRE(count(threshold) == std::clamp(budget, std::size_t(4), std::size_t(32)));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/convolution: budget_sparsity(ifft_scaling)",
+    "",
+    (neo::convolution::sparse_upola_convolver,
+     neo::convolution::sparse_upols_convolver,
+     neo::convolution::lod_upola_convolver,
+     neo::convolution::lod_upols_convolver),
+    (std::complex<float>, std::complex<double>)
+)
+{
+    using Convolver = TestType;
+    using Complex   = typename Convolver::value_type;
+    using Float     = typename Complex::value_type;
+
+    auto const block_size = GENERATE(as<std::size_t>{}, 128, 512);
+    CAPTURE(block_size);
+
+    auto const filter     = neo::generate_noise_filter<Float>(block_size * 8UL, block_size, Catch::getSeed());
+    auto const channel    = filter.to_mdspan();
+    auto const budget     = channel.extent(0) * channel.extent(1) / 4;
+    auto const importance = neo::convolution::a_weighted_importance<Float>{channel, 44'100.0};
+
+    // Both convolvers must prune against the importance of the unscaled filter
+    auto reference     = Convolver{};
+    auto convolver     = Convolver{neo::convolution::ifft_scaling::filter};
+    auto kept          = std::size_t(0);
+    auto kept_expected = std::size_t(0);
+
+    if constexpr (std::same_as<typename Convolver::filter_type, neo::convolution::lod_filter<Complex>>) {
+        auto const threshold = neo::convolution::budget_threshold(channel, importance, budget);
+        auto thresholds      = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{1};
+        thresholds(0)        = threshold;
+
+        auto const counted = [&importance, threshold](std::size_t& n) {
+            return [&importance, threshold, &n](auto row, auto col, auto const& value) {
+                auto const score = importance(row, col, value);
+                n += static_cast<std::size_t>(score > threshold);
+                return score;
+            };
+        };
+        reference.filter(channel, counted(kept_expected), thresholds.to_mdspan());
+        convolver.filter(channel, counted(kept), thresholds.to_mdspan());
+    } else {
+        auto const sparsity = neo::convolution::budget_sparsity(channel, importance, budget);
+        auto const counted  = [&sparsity](std::size_t& n) {
+            return [&sparsity, &n](auto row, auto col, auto const& value) {
+                auto const keep = sparsity(row, col, value);
+                n += static_cast<std::size_t>(keep);
+                return keep;
+            };
+        };
+        reference.filter(channel, counted(kept_expected));
+        convolver.filter(channel, counted(kept));
+    }
+
+    // Scores of noise are unique, so the budget is hit exactly
+    REQUIRE(kept_expected == budget);
+    REQUIRE(kept == kept_expected);
+
+    auto const signal = neo::generate_noise_signal<Float>(block_size * 12UL, Catch::getSeed() + 1U);
+    auto expected     = signal;
+    auto output       = signal;
+    for (auto i = std::size_t(0); i < signal.extent(0); i += block_size) {
+        auto const range = std::tuple{i, i + block_size};
+        reference(stdex::submdspan(expected.to_mdspan(), range));
+        convolver(stdex::submdspan(output.to_mdspan(), range));
+    }
+
+    REQUIRE(neo::allclose(output.to_mdspan(), expected.to_mdspan(), Float(1e-4)));
+}
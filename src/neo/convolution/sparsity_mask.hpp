@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/execution/thread_pool.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace neo::convolution {
+
+namespace detail {
+
+template<in_vector InVec, in_vector Thresholds, out_vector OutMask>
+auto sparsity_mask_row(InVec row, Thresholds thresholds, OutMask mask) noexcept -> void
+{
+    auto const size = static_cast<std::size_t>(row.extent(0));
+
+    if constexpr (always_vectorizable<InVec, Thresholds, OutMask>) {
+        // No index math or accessor in the loop, so the compiler can vectorize it
+        auto const* NEO_RESTRICT in        = row.data_handle();
+        auto const* NEO_RESTRICT threshold = thresholds.data_handle();
+        auto* NEO_RESTRICT out             = mask.data_handle();
+
+        for (auto i = std::size_t(0); i < size; ++i) {
+            auto const re    = in[i].real();
+            auto const im    = in[i].imag();
+            auto const power = re * re + im * im;
+            out[i]           = static_cast<typename OutMask::value_type>(power > threshold[i]);
+        }
+    } else {
+        for (auto i = std::size_t(0); i < size; ++i) {
+            auto const re    = row[i].real();
+            auto const im    = row[i].imag();
+            auto const power = re * re + im * im;
+            mask[i]          = static_cast<typename OutMask::value_type>(power > thresholds[i]);
+        }
+    }
+}
+
+}  // namespace detail
+
+/// \brief Marks every bin whose power is above the linear threshold of its column.
+///
+/// Single pass without any transcendental functions per bin. The thresholds are
+/// usually precomputed once per column, e.g. with a_weighted_importance::power_thresholds.
+/// The result can be passed to csr_matrix or sparse_filter::filter.
+///
+/// \ingroup neo-convolution
+template<in_matrix InMat, in_vector Thresholds, out_matrix OutMask>
+    requires(complex<value_type_t<InMat>> and std::integral<value_type_t<OutMask>>)
+auto sparsity_mask(InMat filter, Thresholds thresholds, OutMask mask) noexcept -> void
+{
+    assert(neo::detail::extents_equal(filter, mask));
+    assert(thresholds.extent(0) == filter.extent(1));
+
+    for (auto row = std::size_t(0); row < static_cast<std::size_t>(filter.extent(0)); ++row) {
+        detail::sparsity_mask_row(
+            stdex::submdspan(filter, row, stdex::full_extent),
+            thresholds,
+            stdex::submdspan(mask, row, stdex::full_extent)
+        );
+    }
+}
+
+/// \brief Same as sparsity_mask, with the rows spread over the threads of the pool.
+/// \ingroup neo-convolution
+template<in_matrix InMat, in_vector Thresholds, out_matrix OutMask>
+    requires(complex<value_type_t<InMat>> and std::integral<value_type_t<OutMask>>)
+auto sparsity_mask(InMat filter, Thresholds thresholds, OutMask mask, thread_pool& pool) -> void
+{
+    assert(neo::detail::extents_equal(filter, mask));
+    assert(thresholds.extent(0) == filter.extent(1));
+
+    auto const rows   = static_cast<std::size_t>(filter.extent(0));
+    auto const chunks = std::min(pool.num_threads(), rows);
+
+    pool.parallel_for(chunks, [=](std::size_t chunk) {
+        auto const first = rows * chunk / chunks;
+        auto const last  = rows * (chunk + 1) / chunks;
+        sparsity_mask(
+            stdex::submdspan(filter, std::tuple{first, last}, stdex::full_extent),
+            thresholds,
+            stdex::submdspan(mask, std::tuple{first, last}, stdex::full_extent)
+        );
+    });
+}
+
+}  // namespace neo::convolution
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+
+#include "sparsity_mask.hpp"
+
+#include <neo/container/csr_matrix.hpp>
+#include <neo/convolution/sparse_convolver.hpp>
+#include <neo/convolution/sparsity_budget.hpp>
+#include <neo/testing/convolution.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+
+TEMPLATE_TEST_CASE("neo/convolution: sparsity_mask", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const filter  = neo::generate_noise_filter<Float>(8192, 256, Catch::getSeed());
+    auto const channel = filter.to_mdspan();
+
+    auto const threshold = GENERATE(as<Float>{}, -200, -90, -60, -30, -10, 0, 10);
+    auto const low_bins  = GENERATE(as<std::size_t>{}, 0, 4);
+    CAPTURE(threshold);
+    CAPTURE(low_bins);
+
+    auto const importance = neo::convolution::a_weighted_importance<Float>{channel, 44'100.0, low_bins};
+    auto const thresholds = importance.power_thresholds(threshold);
+
+    auto mask = stdex::mdarray<std::uint8_t, stdex::dextents<std::size_t, 2>>{channel.extents()};
+    neo::convolution::sparsity_mask(channel, thresholds.to_mdspan(), mask.to_mdspan());
+
+    auto pool          = neo::thread_pool{3};
+    auto parallel_mask = stdex::mdarray<std::uint8_t, stdex::dextents<std::size_t, 2>>{channel.extents()};
+    neo::convolution::sparsity_mask(channel, thresholds.to_mdspan(), parallel_mask.to_mdspan(), pool);
+
+    for (auto row = std::size_t(0); row < channel.extent(0); ++row) {
+        for (auto col = std::size_t(0); col < channel.extent(1); ++col) {
+            REQUIRE(mask(row, col) == parallel_mask(row, col));
+
+            // Same decision as the log-domain predicate, up to rounding right at the threshold
+            auto const score = importance(row, col, channel(row, col));
+            if (std::abs(score - threshold) > Float(1e-3)) {
+                REQUIRE(mask(row, col) == static_cast<std::uint8_t>(score > threshold));
+            }
+            if (col < low_bins) {
+                REQUIRE(mask(row, col) == 1);
+            }
+        }
+    }
+
+    auto const matrix = neo::csr_matrix<Complex>{channel, mask.to_mdspan()};
+    REQUIRE(matrix.extents() == channel.extents());
+
+    auto convolver = neo::convolution::sparse_upola_convolver<Complex>{};
+    convolver.filter(channel, mask.to_mdspan());
+}
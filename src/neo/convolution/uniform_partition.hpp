@@ -2,27 +2,182 @@
 
 #pragma once
 
+#include <neo/complex/complex.hpp>
 #include <neo/container/mdspan.hpp>
-#include <neo/fft/stft.hpp>
-#include <neo/math/windowing.hpp>
+#include <neo/execution/thread_pool.hpp>
+#include <neo/fft/order.hpp>
+#include <neo/fft/rfft.hpp>
+#include <neo/math/idiv.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <concepts>
+#include <cstddef>
 
 namespace neo::convolution {
 
+namespace detail {
+
+/// Transforms one zero-padded partition at a time. The padding is only
+/// cleared when a shorter partition follows a longer one.
+template<std::floating_point Float, complex Complex>
+struct uniform_partition_worker
+{
+    explicit uniform_partition_worker(std::size_t block_size)
+        : _rfft{fft::from_order, fft::next_order(block_size * 2UL)}
+        , _block_size{block_size}
+    {}
+
+    template<in_matrix InMat, typename Sink>
+    auto operator()(InMat impulse_response, std::size_t channel, std::size_t partition, Sink& sink) -> void
+    {
+        auto const length = static_cast<std::size_t>(impulse_response.extent(1));
+        auto const first  = partition * _block_size;
+        auto const count  = std::min(_block_size, length - first);
+        auto const frame  = _frame.to_mdspan();
+
+        for (auto i = std::size_t(0); i < count; ++i) {
+            frame[i] = static_cast<Float>(impulse_response(channel, first + i));
+        }
+        for (auto i = count; i < _filled; ++i) {
+            frame[i] = Float(0);
+        }
+        _filled = count;
+
+        fft::rfft(_rfft, frame, _spectrum.to_mdspan());
+        sink(channel, partition, stdex::mdspan<Complex const, stdex::dextents<std::size_t, 1>>{_spectrum.to_mdspan()});
+    }
+
+private:
+    fft::rfft_plan<Float, Complex> _rfft;
+    std::size_t _block_size;
+    std::size_t _filled{0};
+    stdex::mdarray<Float, stdex::dextents<std::size_t, 1>> _frame{_rfft.size()};
+    stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>> _spectrum{_rfft.size() / 2UL + 1UL};
+};
+
+template<typename Sink, typename Float>
+concept uniform_partition_sink = std::invocable<
+    Sink&,
+    std::size_t,
+    std::size_t,
+    stdex::mdspan<std::complex<Float> const, stdex::dextents<std::size_t, 1>>>;
+
+}  // namespace detail
+
+/// \brief Number of partitions & bins of each channel of uniform_partition.
+/// \ingroup neo-convolution
+[[nodiscard]] inline auto uniform_partition_extents(std::size_t length, std::size_t block_size)
+    -> stdex::dextents<std::size_t, 2>
+{
+    assert(block_size > 0);
+    return stdex::dextents<std::size_t, 2>{
+        idiv(length, block_size),
+        fft::size(fft::next_order(block_size * 2UL)) / 2UL + 1UL,
+    };
+}
+
+/// \brief Hands the spectrum of each partition to sink(channel, partition, spectrum).
+///
+/// Writing straight into the final layout, e.g. split-complex or quantized,
+/// skips the intermediate channels x partitions x bins tensor. The spectrum is
+/// only valid during the call.
+///
+/// \ingroup neo-convolution
+template<in_matrix InMat, typename Sink>
+    requires detail::uniform_partition_sink<Sink, value_type_t<InMat>>
+auto uniform_partition(InMat impulse_response, std::size_t block_size, Sink sink) -> void
+{
+    using Float   = value_type_t<InMat>;
+    using Complex = std::complex<Float>;
+
+    auto const num_channels   = static_cast<std::size_t>(impulse_response.extent(0));
+    auto const num_partitions = idiv(static_cast<std::size_t>(impulse_response.extent(1)), block_size);
+
+    auto worker = detail::uniform_partition_worker<Float, Complex>{block_size};
+    for (auto ch = std::size_t(0); ch < num_channels; ++ch) {
+        for (auto p = std::size_t(0); p < num_partitions; ++p) {
+            worker(impulse_response, ch, p, sink);
+        }
+    }
+}
+
+/// \brief Splits the (channel, partition) jobs across the pool, every thread uses its own rfft plan.
+///
+/// The sink is called concurrently, but never twice for the same (channel, partition).
+///
+/// \ingroup neo-convolution
+template<in_matrix InMat, typename Sink>
+    requires detail::uniform_partition_sink<Sink, value_type_t<InMat>>
+auto uniform_partition(InMat impulse_response, std::size_t block_size, thread_pool& pool, Sink sink) -> void
+{
+    using Float   = value_type_t<InMat>;
+    using Complex = std::complex<Float>;
+
+    auto const num_partitions = idiv(static_cast<std::size_t>(impulse_response.extent(1)), block_size);
+    auto const num_jobs       = static_cast<std::size_t>(impulse_response.extent(0)) * num_partitions;
+    auto const chunks         = std::min(pool.num_threads(), num_jobs);
+
+    if (chunks <= 1) {
+        uniform_partition(impulse_response, block_size, sink);
+        return;
+    }
+
+    pool.parallel_for(chunks, [=, &sink](std::size_t chunk) {
+        // Jobs of a chunk are neighbours, so each thread streams through a contiguous part of the channels
+        auto worker = detail::uniform_partition_worker<Float, Complex>{block_size};
+        for (auto job = num_jobs * chunk / chunks; job < num_jobs * (chunk + 1) / chunks; ++job) {
+            worker(impulse_response, job / num_partitions, job % num_partitions, sink);
+        }
+    });
+}
+
 /// \ingroup neo-convolution
 template<in_matrix InMat>
 [[nodiscard]] auto uniform_partition(InMat impulse_response, std::size_t block_size)
 {
-    using Float = typename InMat::value_type;
-
-    return fft::stft(
-        impulse_response,
-        {
-            .frame_size     = block_size,
-            .transform_size = block_size * 2UL,
-            .overlap_size   = 0,
-            .window         = rectangular_window<Float>{},
+    using Float   = value_type_t<InMat>;
+    using Complex = std::complex<Float>;
+
+    auto const extents = uniform_partition_extents(static_cast<std::size_t>(impulse_response.extent(1)), block_size);
+    auto result        = stdex::mdarray<Complex, stdex::dextents<std::size_t, 3>>{
+        static_cast<std::size_t>(impulse_response.extent(0)),
+        extents.extent(0),
+        extents.extent(1),
+    };
+
+    auto out = result.to_mdspan();
+    uniform_partition(impulse_response, block_size, [out](std::size_t ch, std::size_t p, auto spectrum) {
+        for (auto bin = std::size_t(0); bin < spectrum.extent(0); ++bin) {
+            out(ch, p, bin) = spectrum[bin];
+        }
+    });
+    return result;
+}
+
+/// \ingroup neo-convolution
+template<in_matrix InMat>
+[[nodiscard]] auto uniform_partition(InMat impulse_response, std::size_t block_size, thread_pool& pool)
+{
+    using Float   = value_type_t<InMat>;
+    using Complex = std::complex<Float>;
+
+    auto const extents = uniform_partition_extents(static_cast<std::size_t>(impulse_response.extent(1)), block_size);
+    auto result        = stdex::mdarray<Complex, stdex::dextents<std::size_t, 3>>{
+        static_cast<std::size_t>(impulse_response.extent(0)),
+        extents.extent(0),
+        extents.extent(1),
+    };
+
+    auto out = result.to_mdspan();
+    uniform_partition(impulse_response, block_size, pool, [out](std::size_t ch, std::size_t p, auto spectrum) {
+        for (auto bin = std::size_t(0); bin < spectrum.extent(0); ++bin) {
+            out(ch, p, bin) = spectrum[bin];
         }
-    );
+    });
+    return result;
 }
 
 }  // namespace neo::convolution
@@ -2,8 +2,19 @@
 
 #include "uniform_partition.hpp"
 
+#include <neo/algorithm/allclose.hpp>
+#include <neo/algorithm/copy.hpp>
+#include <neo/fft/stft.hpp>
+#include <neo/testing/testing.hpp>
+
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 TEMPLATE_TEST_CASE("neo/convolution: uniform_partition", "", float, double)
 {
@@ -36,3 +47,88 @@ TEMPLATE_TEST_CASE("neo/convolution: uniform_partition", "", float, double)
         REQUIRE(partitions.extent(2) == 129);
     }
 }
+
+TEMPLATE_TEST_CASE("neo/convolution: uniform_partition(thread_pool)", "", float, double)
+{
+    using Float = TestType;
+
+    auto const num_channels = GENERATE(as<std::size_t>{}, 1, 2, 5);
+    auto const length       = GENERATE(as<std::size_t>{}, 100, 4095, 4096);
+    auto const block_size   = GENERATE(as<std::size_t>{}, 64, 100, 512);
+    auto const num_threads  = GENERATE(as<std::size_t>{}, 1, 2, 4);
+    CAPTURE(num_channels);
+    CAPTURE(length);
+    CAPTURE(block_size);
+    CAPTURE(num_threads);
+
+    auto impulse = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_channels, length};
+    for (auto ch = std::size_t(0); ch < num_channels; ++ch) {
+        auto const noise = neo::generate_noise_signal<Float>(length, Catch::getSeed() + ch);
+        neo::copy(noise.to_mdspan(), stdex::submdspan(impulse.to_mdspan(), ch, stdex::full_extent));
+    }
+
+    auto pool           = neo::thread_pool{num_threads};
+    auto const expected = neo::fft::stft(
+        impulse.to_mdspan(),
+        {
+            .frame_size     = block_size,
+            .transform_size = block_size * 2UL,
+            .overlap_size   = 0,
+            .window         = neo::rectangular_window<Float>{},
+        }
+    );
+
+    SECTION("mdarray")
+    {
+        auto const serial   = neo::convolution::uniform_partition(impulse.to_mdspan(), block_size);
+        auto const parallel = neo::convolution::uniform_partition(impulse.to_mdspan(), block_size, pool);
+        REQUIRE(serial.extents() == expected.extents());
+        REQUIRE(parallel.extents() == expected.extents());
+
+        // The stft pairs up frames in one complex transform, which rounds differently
+        auto const tolerance = std::numeric_limits<Float>::epsilon() * static_cast<Float>(block_size * 2UL);
+
+        auto const full = stdex::full_extent;
+        for (auto ch = std::size_t(0); ch < num_channels; ++ch) {
+            auto const channel = stdex::submdspan(expected.to_mdspan(), ch, full, full);
+            REQUIRE(neo::allclose(stdex::submdspan(serial.to_mdspan(), ch, full, full), channel, tolerance));
+            REQUIRE(neo::allclose(stdex::submdspan(parallel.to_mdspan(), ch, full, full), channel, tolerance));
+        }
+    }
+
+    SECTION("split")
+    {
+        // Written straight into a split-complex layout, without the complex tensor in between
+        auto const extents = neo::convolution::uniform_partition_extents(length, block_size);
+        auto split         = stdex::mdarray<Float, stdex::dextents<std::size_t, 4>>{
+            2,
+            num_channels,
+            extents.extent(0),
+            extents.extent(1),
+        };
+
+        auto out = split.to_mdspan();
+        neo::convolution::uniform_partition(
+            impulse.to_mdspan(),
+            block_size,
+            pool,
+            [out](std::size_t ch, std::size_t p, auto spectrum) {
+                for (auto bin = std::size_t(0); bin < spectrum.extent(0); ++bin) {
+                    out(0, ch, p, bin) = spectrum[bin].real();
+                    out(1, ch, p, bin) = spectrum[bin].imag();
+                }
+            }
+        );
+
+        auto max_error = Float(0);
+        for (auto ch = std::size_t(0); ch < num_channels; ++ch) {
+            for (auto p = std::size_t(0); p < extents.extent(0); ++p) {
+                for (auto bin = std::size_t(0); bin < extents.extent(1); ++bin) {
+                    max_error = std::max(max_error, std::abs(split(0, ch, p, bin) - expected(ch, p, bin).real()));
+                    max_error = std::max(max_error, std::abs(split(1, ch, p, bin) - expected(ch, p, bin).imag()));
+                }
+            }
+        }
+        REQUIRE(max_error < Float(1e-4));
+    }
+}
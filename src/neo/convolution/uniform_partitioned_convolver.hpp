@@ -6,6 +6,14 @@
 #include <neo/complex.hpp>
 #include <neo/container/mdspan.hpp>
 #include <neo/convolution/fdl_index.hpp>
+#include <neo/convolution/ifft_scaling.hpp>
+#include <neo/math/scoped_flush_denormals.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#include <array>
+#include <optional>
+#include <span>
+#include <utility>
 
 namespace neo::convolution {
 
@@ -21,10 +29,42 @@ struct uniform_partitioned_convolver
 
     uniform_partitioned_convolver() = default;
 
+    /// \brief With ifft_scaling::filter the 1/N of the inverse transform is folded into the filter.
+    ///
+    /// Callbacks passed along to the filter, e.g. a sparsity or importance function, still see the unscaled
+    /// coefficients, so the kept bins are the same as with ifft_scaling::output.
+    explicit uniform_partitioned_convolver(ifft_scaling scaling) noexcept;
+
+    [[nodiscard]] auto scaling() const noexcept -> ifft_scaling;
+
     auto filter(in_matrix auto filter, auto... args) -> void;
+
+    /// \brief Replaces the filter coefficients while keeping the FDL and overlap state.
+    ///
+    /// The update is applied at the start of the next block, see sparse_filter::update.
+    template<in_matrix InMat, typename... Args>
+        requires requires(Filter& f, InMat filter, Args... args) { f.update(filter, args...); }
+    auto update_filter(InMat filter, Args... args) -> bool;
+
+    /// Selects the level of detail, see lod_filter.
+    auto set_level(std::size_t level) noexcept -> void
+        requires requires(Filter& f, std::size_t l) { f.set_level(l); };
+
+    /// \brief Processes each block inside a scoped_flush_denormals, so decaying tails don't hit the slow path.
+    ///
+    /// Off by default, hosts that already flush denormals (e.g. a plugin) don't pay for the mode switch.
+    auto set_flush_denormals(bool flush) noexcept -> void;
+
+    [[nodiscard]] auto flush_denormals() const noexcept -> bool;
+
     auto operator()(in_vector auto block) -> void;
 
 private:
+    /// Rows of silence contribute nothing, with a supporting FDL their products are skipped.
+    [[nodiscard]] auto is_silent(size_t index) const noexcept -> bool;
+
+    ifft_scaling _scaling{ifft_scaling::output};
+    bool _flush_denormals{false};
     Overlap _overlap{1, 1};
 
     Fdl _fdl;
@@ -34,33 +74,146 @@ private:
     accumulator_type _accumulator;
 };
 
+template<typename Overlap, typename Fdl, typename Filter>
+uniform_partitioned_convolver<Overlap, Fdl, Filter>::uniform_partitioned_convolver(ifft_scaling scaling) noexcept
+    : _scaling{scaling}
+{}
+
+template<typename Overlap, typename Fdl, typename Filter>
+auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::scaling() const noexcept -> ifft_scaling
+{
+    return _scaling;
+}
+
 template<typename Overlap, typename Fdl, typename Filter>
 auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::filter(in_matrix auto filter, auto... args) -> void
 {
-    _overlap     = Overlap{filter.extent(1) - 1, filter.extent(1) - 1};
+    _overlap     = Overlap{filter.extent(1) - 1, filter.extent(1) - 1, _scaling};
     _indexer     = fdl_index<size_t>{filter.extent(0)};
     _fdl         = Fdl{filter.extents()};
     _accumulator = accumulator_type{filter.extent(1)};
-    _filter.filter(filter, args...);
+
+    if (_scaling == ifft_scaling::filter) {
+        using Value = value_type_t<decltype(filter)>;
+
+        auto const size   = _overlap.transform_size();
+        auto const scaled = detail::prescale_filter(filter, size);
+        _filter.filter(scaled.to_mdspan(), detail::unscaled_callback<Value>(args, size)...);
+    } else {
+        _filter.filter(filter, args...);
+    }
+}
+
+template<typename Overlap, typename Fdl, typename Filter>
+template<in_matrix InMat, typename... Args>
+    requires requires(Filter& f, InMat filter, Args... args) { f.update(filter, args...); }
+auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::update_filter(InMat filter, Args... args) -> bool
+{
+    if (_scaling == ifft_scaling::filter) {
+        using Value = value_type_t<InMat>;
+
+        auto const size   = _overlap.transform_size();
+        auto const scaled = detail::prescale_filter(filter, size);
+        return _filter.update(scaled.to_mdspan(), detail::unscaled_callback<Value>(args, size)...);
+    }
+    return _filter.update(filter, args...);
+}
+
+template<typename Overlap, typename Fdl, typename Filter>
+auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::set_level(std::size_t level) noexcept -> void
+    requires requires(Filter& f, std::size_t l) { f.set_level(l); }
+{
+    _filter.set_level(level);
+}
+
+template<typename Overlap, typename Fdl, typename Filter>
+auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::set_flush_denormals(bool flush) noexcept -> void
+{
+    _flush_denormals = flush;
+}
+
+template<typename Overlap, typename Fdl, typename Filter>
+auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::flush_denormals() const noexcept -> bool
+{
+    return _flush_denormals;
+}
+
+template<typename Overlap, typename Fdl, typename Filter>
+auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::is_silent(size_t index) const noexcept -> bool
+{
+    if constexpr (requires { _fdl.is_silent(index); }) {
+        return _fdl.is_silent(index);
+    } else {
+        return false;
+    }
 }
 
 template<typename Overlap, typename Fdl, typename Filter>
 auto uniform_partitioned_convolver<Overlap, Fdl, Filter>::operator()(in_vector auto block) -> void
 {
-    _overlap(block, [this](inout_vector auto inout) {
+    auto denormals = std::optional<scoped_flush_denormals>{};
+    if (_flush_denormals) {
+        denormals.emplace();
+    }
+
+    if constexpr (requires { _filter.apply_update(); }) {
+        _filter.apply_update();
+    }
+
+    _overlap(block, [this](auto inout) {
         fill(_accumulator.to_mdspan(), value_type_t<accumulator_type>{});
 
-        auto insert   = [this, inout](auto index) { _fdl.insert(inout, index); };
-        auto multiply = [this](auto index, auto filter) { _filter(_fdl[index], filter, _accumulator.to_mdspan()); };
-        _indexer(insert, multiply);
+        auto insert = [this, inout](auto index) { _fdl.insert(inout, index); };
+
+        using fdl_row   = decltype(std::as_const(_fdl)[size_t{}]);
+        using row_batch = std::span<fdl_row const>;
+        using idx_batch = std::span<size_t const>;
+
+        // Filters that take a batch of segments keep the accumulator in registers across them
+        if constexpr (requires(Filter& f, row_batch r, idx_batch i) { f(r, i, _accumulator.to_mdspan()); }) {
+            auto multiply = [this](idx_batch segments, idx_batch filters) {
+                auto rows    = std::array<fdl_row, fdl_index<size_t>::batch_size>{};
+                auto indices = std::array<size_t, fdl_index<size_t>::batch_size>{};
+                auto count   = size_t(0);
+                for (auto i = size_t(0); i < segments.size(); ++i) {
+                    if (not is_silent(segments[i])) {
+                        rows[count]    = std::as_const(_fdl)[segments[i]];
+                        indices[count] = filters[i];
+                        ++count;
+                    }
+                }
+                if (count != 0) {
+                    _filter(row_batch{rows.data(), count}, idx_batch{indices.data(), count}, _accumulator.to_mdspan());
+                }
+            };
+            _indexer.batched(insert, multiply);
+        } else {
+            auto multiply = [this](auto index, auto filter) {
+                if (not is_silent(index)) {
+                    _filter(_fdl[index], filter, _accumulator.to_mdspan());
+                }
+            };
+            _indexer(insert, multiply);
+        }
 
         if constexpr (accumulator_type::rank() == 1) {
             copy(_accumulator.to_mdspan(), inout);
+        } else if constexpr (requires { inout.real, inout.imag; }) {
+            // Split overlap, the accumulator rows already have the right layout
+            copy(stdex::submdspan(_accumulator.to_mdspan(), 0, stdex::full_extent), inout.real);
+            copy(stdex::submdspan(_accumulator.to_mdspan(), 1, stdex::full_extent), inout.imag);
         } else {
             for (auto i{0}; i < static_cast<int>(inout.extent(0)); ++i) {
                 inout[i] = {_accumulator(0, i), _accumulator(1, i)};
             }
         }
+
+        // Bins above are never touched by the filter, the inverse transform can skip them
+        if constexpr (requires { _filter.max_active_bin(); }) {
+            return _filter.max_active_bin();
+        } else {
+            return;
+        }
     });
 }
 
@@ -4,7 +4,8 @@
 #include "sparse_convolver.hpp"
 
 #include <neo/algorithm/allclose.hpp>
-#include <neo/convolution/uniform_partition.hpp>
+#include <neo/convolution/direct_convolve.hpp>
+#include <neo/testing/convolution.hpp>
 #include <neo/testing/testing.hpp>
 
 #include <catch2/catch_approx.hpp>
@@ -13,7 +14,12 @@
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <limits>
 #include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace {
 
@@ -32,6 +38,21 @@ static_assert(not is_sparse_convolver<neo::convolution::upols_convolver<std::com
 static_assert(is_sparse_convolver<neo::convolution::sparse_upols_convolver<std::complex<float>>>);
 static_assert(is_sparse_convolver<neo::convolution::sparse_upola_convolver<std::complex<float>>>);
 
+// Regular types, e.g. for a std::vector with one convolver per channel
+static_assert(std::is_move_constructible_v<neo::convolution::upols_convolver<std::complex<float>>>);
+static_assert(std::is_move_constructible_v<neo::convolution::sparse_upols_convolver<std::complex<float>>>);
+static_assert(std::is_move_constructible_v<neo::convolution::sparse_upola_convolver<std::complex<float>>>);
+static_assert(std::is_move_assignable_v<neo::convolution::sparse_upola_convolver<std::complex<float>>>);
+static_assert(std::is_copy_constructible_v<neo::convolution::sparse_upola_convolver<std::complex<float>>>);
+
+// Only the convolvers whose filter reports a max_active_bin pay for the pruned inverse transform
+static_assert(std::same_as<
+              neo::convolution::upols_convolver<std::complex<float>>::overlap_type,
+              neo::convolution::overlap_save<std::complex<float>, neo::fft::rfft_plan<float>>>);
+static_assert(std::same_as<
+              neo::convolution::sparse_upola_convolver<std::complex<float>>::overlap_type,
+              neo::convolution::pruned_overlap_add<std::complex<float>>>);
+
 TEMPLATE_PRODUCT_TEST_CASE(
     "neo/convolution: convolver",
     "",
@@ -73,3 +94,271 @@ TEMPLATE_PRODUCT_TEST_CASE(
 
     REQUIRE(neo::allclose(output.to_mdspan(), signal.to_mdspan()));
 }
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/convolution: convolver(update_filter)",
+    "",
+    (neo::convolution::sparse_upola_convolver, neo::convolution::sparse_upols_convolver),
+    (std::complex<float>, std::complex<double>)
+)
+{
+    using Convolver = TestType;
+    using Complex   = typename Convolver::value_type;
+    using Float     = typename Complex::value_type;
+
+    auto const block_size = GENERATE(as<std::size_t>{}, 128, 256);
+    CAPTURE(block_size);
+
+    auto const filter  = neo::generate_noise_filter<Float>(block_size * 4UL, block_size, Catch::getSeed());
+    auto const channel = filter.to_mdspan();
+
+    auto const keep_all  = [](auto, auto, auto) { return true; };
+    auto const keep_none = [](auto, auto, auto) { return false; };
+
+    auto reference = Convolver{};
+    reference.filter(channel, keep_all);
+
+    auto convolver = Convolver{};
+    convolver.filter(channel, keep_none);
+
+    auto const signal = neo::generate_noise_signal<Float>(block_size * 16UL, Catch::getSeed());
+    auto expected     = signal;
+    auto output       = signal;
+
+    auto const update_block = std::size_t(8);
+    for (auto b = std::size_t(0); b < signal.extent(0) / block_size; ++b) {
+        if (b == update_block) {
+            auto updated = false;
+            auto thread  = std::thread{[&] { updated = convolver.update_filter(channel, keep_all); }};
+            thread.join();
+            REQUIRE(updated);
+
+            // Previous update has not been applied yet
+            REQUIRE_FALSE(convolver.update_filter(channel, keep_none));
+
+            // The pending update moves along with the convolver
+            auto moved = std::move(convolver);
+            convolver  = std::move(moved);
+        }
+
+        auto const range = std::tuple{b * block_size, (b + 1) * block_size};
+        reference(stdex::submdspan(expected.to_mdspan(), range));
+        convolver(stdex::submdspan(output.to_mdspan(), range));
+    }
+
+    // The FDL survives the update, so the output matches as soon as the old overlap is gone
+    auto const first = (update_block + 1) * block_size;
+    auto const tail  = std::tuple{first, signal.extent(0)};
+    REQUIRE(neo::allclose(
+        stdex::submdspan(output.to_mdspan(), tail),
+        stdex::submdspan(expected.to_mdspan(), tail),
+        Float(1e-4)
+    ));
+
+    // Nothing was heard before the update
+    for (auto i = std::size_t(0); i < update_block * block_size; ++i) {
+        REQUIRE(output(i) == Catch::Approx(0.0));
+    }
+}
+
+TEMPLATE_TEST_CASE("neo/convolution: convolver(max_active_bin)", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const block_size = GENERATE(as<std::size_t>{}, 128, 512);
+    auto const max_bin    = GENERATE(as<std::size_t>{}, 0, 5, 31, 63, 200);
+    CAPTURE(block_size);
+    CAPTURE(max_bin);
+
+    auto const filter  = neo::generate_noise_filter<Float>(block_size * 4UL, block_size, Catch::getSeed());
+    auto const channel = filter.to_mdspan();
+
+    // Dense reference with the same band limit
+    auto band_limited = stdex::mdarray<Complex, stdex::dextents<std::size_t, 2>>{channel.extents()};
+    for (auto row = std::size_t(0); row < channel.extent(0); ++row) {
+        for (auto col = std::size_t(0); col <= std::min(max_bin, channel.extent(1) - 1); ++col) {
+            band_limited(row, col) = channel(row, col);
+        }
+    }
+
+    auto sparse = neo::convolution::sparse_upols_convolver<Complex>{};
+    sparse.filter(channel, [max_bin](auto, auto col, auto) { return col <= max_bin; });
+
+    // Plain rfft_plan, the max bin returned by the filter is ignored
+    using unpruned_convolver = neo::convolution::uniform_partitioned_convolver<
+        neo::convolution::overlap_save<Complex>,
+        neo::convolution::dense_fdl<Complex>,
+        neo::convolution::sparse_filter<Complex>>;
+    auto unpruned = unpruned_convolver{};
+    unpruned.filter(channel, [max_bin](auto, auto col, auto) { return col <= max_bin; });
+
+    auto dense = neo::convolution::upols_convolver<Complex>{};
+    dense.filter(band_limited.to_mdspan());
+
+    auto const signal = neo::generate_noise_signal<Float>(block_size * 8UL, Catch::getSeed());
+    auto output       = signal;
+    auto fallback     = signal;
+    auto expected     = signal;
+    for (auto i = std::size_t(0); i < signal.extent(0); i += block_size) {
+        auto const range = std::tuple{i, i + block_size};
+        sparse(stdex::submdspan(output.to_mdspan(), range));
+        unpruned(stdex::submdspan(fallback.to_mdspan(), range));
+        dense(stdex::submdspan(expected.to_mdspan(), range));
+    }
+
+    REQUIRE(neo::allclose(output.to_mdspan(), expected.to_mdspan(), Float(1e-4)));
+    REQUIRE(neo::allclose(fallback.to_mdspan(), expected.to_mdspan(), Float(1e-4)));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/convolution: convolver(long filter)",
+    "",
+    (neo::convolution::upols_convolver,
+     neo::convolution::upola_convolver,
+     neo::convolution::split_upola_convolver,
+     neo::convolution::split_upols_convolver),
+    (std::complex<float>, std::complex<double>)
+)
+{
+    using Convolver = TestType;
+    using Complex   = typename Convolver::value_type;
+    using Float     = typename Complex::value_type;
+
+    // Spans several batches of the fused multiply-accumulate, including a partial one
+    auto const block_size     = std::size_t(64);
+    auto const num_partitions = GENERATE(as<std::size_t>{}, 7, 8, 9, 20);
+    CAPTURE(num_partitions);
+
+    auto const impulse = neo::generate_noise_signal<Float>(block_size * num_partitions, Catch::getSeed());
+    auto const filter  = neo::partition_impulse(impulse.to_mdspan(), block_size);
+
+    auto convolver = Convolver{};
+    convolver.filter(filter.to_mdspan());
+
+    auto const signal   = neo::generate_noise_signal<Float>(block_size * num_partitions * 3, Catch::getSeed() + 1U);
+    auto const expected = neo::convolution::direct_convolve(signal.to_mdspan(), impulse.to_mdspan());
+
+    auto output = signal;
+    for (auto i = std::size_t(0); i < output.extent(0); i += block_size) {
+        convolver(stdex::submdspan(output.to_mdspan(), std::tuple{i, i + block_size}));
+    }
+
+    for (auto i = std::size_t(0); i < output.extent(0); ++i) {
+        REQUIRE(output(i) == Catch::Approx(expected(i)).margin(1e-3));
+    }
+}
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/convolution: convolver(ifft_scaling)",
+    "",
+    (neo::convolution::upols_convolver,
+     neo::convolution::upola_convolver,
+     neo::convolution::upola_convolver_v2,
+     neo::convolution::split_upola_convolver,
+     neo::convolution::split_upols_convolver,
+     neo::convolution::sparse_upola_convolver,
+     neo::convolution::sparse_upols_convolver),
+    (std::complex<float>, std::complex<double>)
+)
+{
+    using Convolver = TestType;
+    using Complex   = typename Convolver::value_type;
+    using Float     = typename Complex::value_type;
+
+    auto const block_size = GENERATE(as<std::size_t>{}, 128, 512);
+    CAPTURE(block_size);
+
+    auto const filter  = neo::generate_noise_filter<Float>(block_size * 5UL, block_size, Catch::getSeed());
+    auto const channel = filter.to_mdspan();
+
+    auto reference = Convolver{};
+    auto convolver = Convolver{neo::convolution::ifft_scaling::filter};
+    REQUIRE(reference.scaling() == neo::convolution::ifft_scaling::output);
+    REQUIRE(convolver.scaling() == neo::convolution::ifft_scaling::filter);
+
+    if constexpr (is_sparse_convolver<Convolver>) {
+        auto const keep_all = [](auto, auto, auto) { return true; };
+        reference.filter(channel, keep_all);
+        convolver.filter(channel, keep_all);
+    } else {
+        reference.filter(channel);
+        convolver.filter(channel);
+    }
+
+    auto const signal = neo::generate_noise_signal<Float>(block_size * 12UL, Catch::getSeed() + 1U);
+    auto expected     = signal;
+    auto output       = signal;
+    for (auto i = std::size_t(0); i < signal.extent(0); i += block_size) {
+        auto const range = std::tuple{i, i + block_size};
+        reference(stdex::submdspan(expected.to_mdspan(), range));
+        convolver(stdex::submdspan(output.to_mdspan(), range));
+    }
+
+    REQUIRE(neo::allclose(output.to_mdspan(), expected.to_mdspan(), Float(1e-4)));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "neo/convolution: convolver(silence)",
+    "",
+    (neo::convolution::upols_convolver,
+     neo::convolution::upola_convolver,
+     neo::convolution::split_upola_convolver,
+     neo::convolution::split_upols_convolver),
+    (std::complex<float>, std::complex<double>)
+)
+{
+    using Convolver = TestType;
+    using Complex   = typename Convolver::value_type;
+    using Float     = typename Complex::value_type;
+
+    auto const block_size     = std::size_t(64);
+    auto const num_partitions = GENERATE(as<std::size_t>{}, 1, 9, 20);
+    CAPTURE(num_partitions);
+
+    auto const impulse = neo::generate_noise_signal<Float>(block_size * num_partitions, Catch::getSeed());
+    auto const filter  = neo::partition_impulse(impulse.to_mdspan(), block_size);
+
+    auto convolver = Convolver{};
+    REQUIRE_FALSE(convolver.flush_denormals());
+    convolver.set_flush_denormals(true);
+    REQUIRE(convolver.flush_denormals());
+    convolver.filter(filter.to_mdspan());
+
+    // Noise, a gap longer than the filter, a second burst, then silence past the end of the tail
+    auto const gap_start = block_size * 2;
+    auto const gap_end   = gap_start + block_size * (num_partitions + 3);
+    auto const tail_end  = gap_end + block_size * (num_partitions * 2 + 2);
+    auto const num_total = tail_end + block_size * 4;
+
+    auto signal = neo::generate_noise_signal<Float>(num_total, Catch::getSeed() + 1U);
+    for (auto i = gap_start; i < gap_end; ++i) {
+        signal(i) = Float(0);
+    }
+    for (auto i = gap_end + block_size; i < num_total; ++i) {
+        signal(i) = Float(0);
+    }
+
+    auto const expected = neo::convolution::direct_convolve(signal.to_mdspan(), impulse.to_mdspan());
+
+    auto output = signal;
+    for (auto i = std::size_t(0); i < output.extent(0); i += block_size) {
+        convolver(stdex::submdspan(output.to_mdspan(), std::tuple{i, i + block_size}));
+    }
+
+    for (auto i = std::size_t(0); i < output.extent(0); ++i) {
+        REQUIRE(output(i) == Catch::Approx(expected(i)).margin(1e-3));
+    }
+
+    // Once every row of the FDL is silent the output is exactly zero
+    for (auto i = tail_end; i < output.extent(0); ++i) {
+        REQUIRE(output(i) == Float(0));
+    }
+
+    // The floating-point mode of the caller is restored after each block
+    if constexpr (neo::scoped_flush_denormals::is_supported) {
+        volatile auto smallest = std::numeric_limits<Float>::min();
+        volatile auto half     = Float(0.5);
+        REQUIRE(smallest * half != Float(0));
+    }
+}
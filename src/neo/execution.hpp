@@ -0,0 +1,8 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+/// \defgroup neo-execution Execution
+/// Thread pool & parallel loops
+
+#include <neo/execution/thread_pool.hpp>
@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace neo {
+
+/// \brief Fixed size pool of worker threads for fork-join style loops.
+///
+/// The calling thread takes part in every parallel_for, so a pool with
+/// num_threads() == N spawns N - 1 workers. A pool with a single thread never
+/// spawns a worker and runs everything inline. parallel_for is not reentrant,
+/// calling it from inside a task of the same pool deadlocks.
+///
+/// \ingroup neo-execution
+struct thread_pool
+{
+    explicit thread_pool(std::size_t num_threads = default_num_threads());
+    ~thread_pool();
+
+    thread_pool(thread_pool const& other)                    = delete;
+    auto operator=(thread_pool const& other) -> thread_pool& = delete;
+
+    thread_pool(thread_pool&& other)                    = delete;
+    auto operator=(thread_pool&& other) -> thread_pool& = delete;
+
+    [[nodiscard]] static auto default_num_threads() noexcept -> std::size_t;
+
+    /// Number of threads including the calling thread.
+    [[nodiscard]] auto num_threads() const noexcept -> std::size_t;
+
+    /// Calls func(i) for every i in [0, count) and blocks until all calls
+    /// returned. The order of the calls is unspecified. func must not throw.
+    template<std::invocable<std::size_t> Func>
+    auto parallel_for(std::size_t count, Func func) -> void;
+
+private:
+    using task_type = void (*)(void*, std::size_t);
+
+    auto run_tasks() noexcept -> void;
+    auto worker_loop() noexcept -> void;
+
+    std::mutex _submit;
+
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+
+    task_type _task{nullptr};
+    void* _context{nullptr};
+    std::size_t _count{0};
+    std::atomic<std::size_t> _next{0};
+    std::size_t _pending{0};
+    std::uint64_t _generation{0};
+    bool _stop{false};
+
+    std::vector<std::thread> _workers;
+};
+
+inline thread_pool::thread_pool(std::size_t num_threads)
+{
+#if defined(__EMSCRIPTEN__) and not defined(__EMSCRIPTEN_PTHREADS__)
+    num_threads = 1;
+#endif
+
+    auto const num_workers = std::max(num_threads, std::size_t(1)) - 1;
+    _workers.reserve(num_workers);
+    for (auto i{0ULL}; i < num_workers; ++i) {
+        _workers.emplace_back([this] { worker_loop(); });
+    }
+}
+
+inline thread_pool::~thread_pool()
+{
+    {
+        auto lock = std::scoped_lock{_mutex};
+        _stop     = true;
+    }
+    _wake.notify_all();
+
+    for (auto& worker : _workers) {
+        worker.join();
+    }
+}
+
+inline auto thread_pool::default_num_threads() noexcept -> std::size_t
+{
+    return std::max(std::size_t(std::thread::hardware_concurrency()), std::size_t(1));
+}
+
+inline auto thread_pool::num_threads() const noexcept -> std::size_t { return _workers.size() + 1; }
+
+template<std::invocable<std::size_t> Func>
+auto thread_pool::parallel_for(std::size_t count, Func func) -> void
+{
+    if (count == 0) {
+        return;
+    }
+
+    if (_workers.empty() or count == 1) {
+        for (auto i{0ULL}; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    auto submit = std::scoped_lock{_submit};
+
+    {
+        auto lock = std::scoped_lock{_mutex};
+        _task     = [](void* context, std::size_t index) { (*static_cast<Func*>(context))(index); };
+        _context  = &func;
+        _count    = count;
+        _pending  = _workers.size();
+        _next.store(0, std::memory_order_relaxed);
+        ++_generation;
+    }
+    _wake.notify_all();
+
+    run_tasks();
+
+    auto lock = std::unique_lock{_mutex};
+    _done.wait(lock, [this] { return _pending == 0; });
+    _task    = nullptr;
+    _context = nullptr;
+}
+
+inline auto thread_pool::run_tasks() noexcept -> void
+{
+    while (true) {
+        auto const i = _next.fetch_add(1, std::memory_order_relaxed);
+        if (i >= _count) {
+            return;
+        }
+        _task(_context, i);
+    }
+}
+
+inline auto thread_pool::worker_loop() noexcept -> void
+{
+    auto generation = std::uint64_t{0};
+
+    while (true) {
+        {
+            auto lock = std::unique_lock{_mutex};
+            _wake.wait(lock, [this, generation] { return _stop or _generation != generation; });
+            if (_stop) {
+                return;
+            }
+            generation = _generation;
+        }
+
+        run_tasks();
+
+        {
+            auto lock = std::scoped_lock{_mutex};
+            --_pending;
+        }
+        _done.notify_one();
+    }
+}
+
+}  // namespace neo
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+
+#include "thread_pool.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+TEST_CASE("neo/execution: thread_pool")
+{
+    auto const num_threads = GENERATE(as<std::size_t>{}, 1, 2, 3, 8);
+    auto const count       = GENERATE(as<std::size_t>{}, 0, 1, 2, 7, 1000);
+    CAPTURE(num_threads);
+    CAPTURE(count);
+
+    auto pool = neo::thread_pool{num_threads};
+    REQUIRE(pool.num_threads() == num_threads);
+
+    for (auto round{0}; round < 3; ++round) {
+        auto calls = std::vector<std::atomic<int>>(count);
+        pool.parallel_for(count, [&calls](std::size_t i) { calls[i].fetch_add(1); });
+
+        for (auto const& call : calls) {
+            REQUIRE(call.load() == 1);
+        }
+    }
+}
+
+TEST_CASE("neo/execution: thread_pool(0)")
+{
+    auto pool = neo::thread_pool{0};
+    REQUIRE(pool.num_threads() == 1);
+
+    auto sum = std::size_t(0);
+    pool.parallel_for(10, [&sum](std::size_t i) { sum += i; });
+    REQUIRE(sum == 45);
+}
@@ -13,10 +13,14 @@
 #include <neo/fft/fft.hpp>
 #include <neo/fft/norm.hpp>
 #include <neo/fft/order.hpp>
+#include <neo/fft/perceptual_error.hpp>
+#include <neo/fft/pruned_rfft.hpp>
 #include <neo/fft/rfft.hpp>
 #include <neo/fft/rfftfreq.hpp>
 #include <neo/fft/split_fft.hpp>
+#include <neo/fft/split_rfft.hpp>
 #include <neo/fft/stft.hpp>
+#include <neo/fft/stft_processor.hpp>
 #include <neo/fft/twiddle.hpp>
 
 #include <neo/fft/experimental/rfft.hpp>
@@ -7,6 +7,13 @@
 #include <neo/fft/fft.hpp>
 #include <neo/fft/order.hpp>
 #include <neo/math/conj.hpp>
+#include <neo/math/imag.hpp>
+#include <neo/math/real.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <tuple>
+#include <utility>
 
 namespace neo::fft {
 
@@ -54,10 +61,135 @@ struct fallback_rfft_plan
         }
     }
 
+    /// \brief Transforms each row, two rows share one complex transform as real & imaginary part.
+    ///
+    /// The pairs are gathered into tiles, which run through the batched interface
+    /// of the complex plan. The scratch for the tiles is allocated in the constructor.
+    template<in_matrix_of<Float> InMat, out_matrix_of<Complex> OutMat>
+    auto operator()(InMat in, OutMat out) noexcept -> void;
+
+    /// \brief Inverse transforms each row, two rows share one complex transform.
+    ///
+    /// Like the single row inverse, the imaginary parts of DC & Nyquist are ignored.
+    template<in_matrix_of<Complex> InMat, out_matrix_of<Float> OutMat>
+    auto operator()(InMat in, OutMat out) noexcept -> void;
+
 private:
+    [[nodiscard]] static auto num_pairs(size_type order) -> size_type;
+
     size_type _order;
     fft_plan<Complex> _fft{from_order, _order};
     stdex::mdarray<Complex, stdex::dextents<size_type, 1>> _buffer{size()};
+    stdex::mdarray<Complex, stdex::dextents<size_type, 2>> _pairs{num_pairs(_order), size()};
 };
 
+template<typename Float, typename Complex>
+auto fallback_rfft_plan<Float, Complex>::num_pairs(size_type order) -> size_type
+{
+    static constexpr auto const tile_bytes = size_type{256 * 1024};
+    return std::clamp(tile_bytes / (fft::size(order) * sizeof(Complex)), size_type{1}, size_type{32});
+}
+
+template<typename Float, typename Complex>
+template<in_matrix_of<Float> InMat, out_matrix_of<Complex> OutMat>
+auto fallback_rfft_plan<Float, Complex>::operator()(InMat in, OutMat out) noexcept -> void
+{
+    assert(std::cmp_equal(in.extent(0), out.extent(0)));
+    assert(std::cmp_equal(in.extent(1), size()));
+
+    auto const n        = size();
+    auto const coeffs   = n / 2 + 1;
+    auto const num_rows = static_cast<size_type>(in.extent(0));
+    auto const pairs    = _pairs.to_mdspan();
+    auto const half     = Float(0.5);
+
+    for (auto first = size_type(0); first < num_rows; first += pairs.extent(0) * 2) {
+        auto const count = std::min(pairs.extent(0), (num_rows - first + 1) / 2);
+        auto const tile  = stdex::submdspan(pairs, std::tuple{0, count}, stdex::full_extent);
+
+        // z = x + i * y
+        for (auto p = size_type(0); p < count; ++p) {
+            auto const x = first + p * 2;
+            auto const y = x + 1;
+            for (auto i = size_type(0); i < n; ++i) {
+                tile(p, i) = Complex{in(x, i), y < num_rows ? in(y, i) : Float(0)};
+            }
+        }
+
+        fft(_fft, tile);
+
+        // X[k] = (Z[k] + conj(Z[n-k])) / 2, Y[k] = (Z[k] - conj(Z[n-k])) / 2i
+        for (auto p = size_type(0); p < count; ++p) {
+            auto const x = first + p * 2;
+            auto const y = x + 1;
+            for (auto k = size_type(0); k < coeffs; ++k) {
+                auto const zk  = tile(p, k);
+                auto const znk = math::conj(tile(p, (n - k) % n));
+                auto const sum = zk + znk;
+                auto const dif = zk - znk;
+
+                out(x, k) = sum * half;
+                if (y < num_rows) {
+                    out(y, k) = Complex{math::imag(dif) * half, -math::real(dif) * half};
+                }
+            }
+        }
+    }
+}
+
+template<typename Float, typename Complex>
+template<in_matrix_of<Complex> InMat, out_matrix_of<Float> OutMat>
+auto fallback_rfft_plan<Float, Complex>::operator()(InMat in, OutMat out) noexcept -> void
+{
+    assert(std::cmp_equal(in.extent(0), out.extent(0)));
+    assert(std::cmp_equal(out.extent(1), size()));
+
+    auto const n        = size();
+    auto const coeffs   = n / 2 + 1;
+    auto const num_rows = static_cast<size_type>(in.extent(0));
+    auto const pairs    = _pairs.to_mdspan();
+
+    for (auto first = size_type(0); first < num_rows; first += pairs.extent(0) * 2) {
+        auto const count = std::min(pairs.extent(0), (num_rows - first + 1) / 2);
+        auto const tile  = stdex::submdspan(pairs, std::tuple{0, count}, stdex::full_extent);
+
+        // Z = X + i * Y, with the upper halves filled in by symmetry
+        for (auto p = size_type(0); p < count; ++p) {
+            auto const x = first + p * 2;
+            auto const y = x + 1;
+            for (auto k = size_type(0); k < coeffs; ++k) {
+                auto xk = in(x, k);
+                auto yk = y < num_rows ? Complex(in(y, k)) : Complex{};
+                if (k == 0 or k * 2 == n) {
+                    xk = Complex{math::real(xk), Float(0)};
+                    yk = Complex{math::real(yk), Float(0)};
+                }
+
+                auto const xr = math::real(xk);
+                auto const xi = math::imag(xk);
+                auto const yr = math::real(yk);
+                auto const yi = math::imag(yk);
+
+                tile(p, k) = Complex{xr - yi, xi + yr};
+                if (k != 0 and k * 2 < n) {
+                    tile(p, n - k) = Complex{xr + yi, yr - xi};
+                }
+            }
+        }
+
+        ifft(_fft, tile);
+
+        for (auto p = size_type(0); p < count; ++p) {
+            auto const x = first + p * 2;
+            auto const y = x + 1;
+            for (auto i = size_type(0); i < n; ++i) {
+                out(x, i) = math::real(tile(p, i));
+                if (y < num_rows) {
+                    out(y, i) = math::imag(tile(p, i));
+                }
+            }
+        }
+    }
+}
+
 }  // namespace neo::fft
@@ -12,6 +12,7 @@
 #include <neo/fft/reference/c2c_dif5_plan.hpp>
 #include <neo/fft/reference/c2c_dit2_plan.hpp>
 #include <neo/fft/reference/c2c_dit4_plan.hpp>
+#include <neo/fft/reference/c2c_four_step_plan.hpp>
 #include <neo/fft/reference/c2c_stockham_dif2_plan.hpp>
 #include <neo/fft/reference/c2c_stockham_dif3_plan.hpp>
 #include <neo/fft/reference/c2c_stockham_dif4_plan.hpp>
@@ -31,6 +32,9 @@
     #include <neo/fft/backend/mkl.hpp>
 #endif
 
+#include <cassert>
+#include <cstddef>
+
 namespace neo::fft {
 
 #if defined(NEO_HAS_APPLE_ACCELERATE)
@@ -89,4 +93,65 @@ constexpr auto ifft(Plan& plan, InVec input, OutVec output) -> void
     }
 }
 
+/// \brief Transforms each row of the matrix.
+///
+/// Uses the batched interface of the plan, if available. Otherwise one
+/// transform per row is executed.
+/// \ingroup neo-fft
+template<typename Plan, inout_matrix Mat>
+constexpr auto fft(Plan& plan, Mat inout) -> void
+{
+    if constexpr (requires { plan(inout, direction::forward); }) {
+        plan(inout, direction::forward);
+    } else {
+        for (auto row{0ULL}; row < static_cast<std::size_t>(inout.extent(0)); ++row) {
+            fft(plan, stdex::submdspan(inout, row, stdex::full_extent));
+        }
+    }
+}
+
+/// \brief Transforms each row of the input matrix into the same row of the output.
+/// \ingroup neo-fft
+template<typename Plan, in_matrix InMat, out_matrix OutMat>
+constexpr auto fft(Plan& plan, InMat input, OutMat output) -> void
+{
+    assert(detail::extents_equal(input, output));
+
+    if constexpr (requires { plan(input, output, direction::forward); }) {
+        plan(input, output, direction::forward);
+    } else {
+        copy(input, output);
+        fft(plan, output);
+    }
+}
+
+/// \brief Inverse transforms each row of the matrix.
+/// \ingroup neo-fft
+template<typename Plan, inout_matrix Mat>
+constexpr auto ifft(Plan& plan, Mat inout) -> void
+{
+    if constexpr (requires { plan(inout, direction::backward); }) {
+        plan(inout, direction::backward);
+    } else {
+        for (auto row{0ULL}; row < static_cast<std::size_t>(inout.extent(0)); ++row) {
+            ifft(plan, stdex::submdspan(inout, row, stdex::full_extent));
+        }
+    }
+}
+
+/// \brief Inverse transforms each row of the input matrix into the same row of the output.
+/// \ingroup neo-fft
+template<typename Plan, in_matrix InMat, out_matrix OutMat>
+constexpr auto ifft(Plan& plan, InMat input, OutMat output) -> void
+{
+    assert(detail::extents_equal(input, output));
+
+    if constexpr (requires { plan(input, output, direction::backward); }) {
+        plan(input, output, direction::backward);
+    } else {
+        copy(input, output);
+        ifft(plan, output);
+    }
+}
+
 }  // namespace neo::fft
@@ -21,6 +21,7 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <random>
 #include <vector>
 
@@ -127,6 +128,49 @@ auto test_fft_plan()
         REQUIRE(neo::allclose(noise.to_mdspan(), io));
     }
 #endif
+
+    SECTION("batch")
+    {
+        auto const num_rows = GENERATE(as<std::size_t>{}, 1, 3, 17);
+        CAPTURE(num_rows);
+
+        auto expected = stdex::mdarray<Complex, stdex::dextents<size_t, 2>>{num_rows, plan.size()};
+        for (auto row{0UL}; row < num_rows; ++row) {
+            auto const seed   = Catch::getSeed() + static_cast<std::uint32_t>(row);
+            auto const signal = neo::generate_noise_signal<Complex>(plan.size(), seed);
+            neo::copy(signal.to_mdspan(), stdex::submdspan(expected.to_mdspan(), row, stdex::full_extent));
+        }
+
+        auto test_batch = [&](auto io) {
+            neo::copy(expected.to_mdspan(), io);
+
+            neo::fft::fft(plan, io);
+            for (auto row{0UL}; row < num_rows; ++row) {
+                auto single = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>{plan.size()};
+                neo::copy(stdex::submdspan(expected.to_mdspan(), row, stdex::full_extent), single.to_mdspan());
+                neo::fft::fft(plan, single.to_mdspan());
+
+                auto const batched = stdex::submdspan(io, row, stdex::full_extent);
+                REQUIRE(neo::allclose(single.to_mdspan(), batched, Float(0.001)));
+            }
+
+            neo::fft::ifft(plan, io);
+            neo::scale(Float(1) / static_cast<Float>(plan.size()), io);
+            REQUIRE(neo::allclose(expected.to_mdspan(), io));
+        };
+
+        auto right = stdex::mdarray<Complex, stdex::dextents<size_t, 2>, stdex::layout_right>{num_rows, plan.size()};
+        test_batch(right.to_mdspan());
+
+        auto left = stdex::mdarray<Complex, stdex::dextents<size_t, 2>, stdex::layout_left>{num_rows, plan.size()};
+        test_batch(left.to_mdspan());
+
+        auto out = stdex::mdarray<Complex, stdex::dextents<size_t, 2>>{num_rows, plan.size()};
+        neo::fft::fft(plan, expected.to_mdspan(), out.to_mdspan());
+        neo::fft::ifft(plan, out.to_mdspan());
+        neo::scale(Float(1) / static_cast<Float>(plan.size()), out.to_mdspan());
+        REQUIRE(neo::allclose(expected.to_mdspan(), out.to_mdspan()));
+    }
 }
 
 template<typename ComplexBatch, typename Kernel>
@@ -207,6 +251,62 @@ static auto test_complex_batch_roundtrip_fft()
 
 }  // namespace
 
+TEMPLATE_TEST_CASE("neo/fft: bitrevorder_plan", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const order = GENERATE(as<std::size_t>{}, 1, 2, 3, 4, 8, 15, 16, 17, 18, 21);
+    CAPTURE(order);
+
+    auto plan        = neo::fft::bitrevorder_plan{order};
+    auto const size  = std::size_t(1) << order;
+    auto const noise = neo::generate_noise_signal<Complex>(size, Catch::getSeed());
+
+    auto expected = noise;
+    neo::fft::bitrevorder(expected.to_mdspan());
+
+    SECTION("complex")
+    {
+        auto actual = noise;
+        plan(actual.to_mdspan());
+        REQUIRE(neo::allclose(expected.to_mdspan(), actual.to_mdspan(), Float(0)));
+    }
+
+    SECTION("interleaved")
+    {
+        auto actual = std::vector<Float>(size * 2U);
+        for (auto i{0U}; i < size; ++i) {
+            actual[i * 2U]      = noise(i).real();
+            actual[i * 2U + 1U] = noise(i).imag();
+        }
+
+        plan(stdex::mdspan{actual.data(), stdex::extents{actual.size()}});
+        auto const interleaved = stdex::mdspan{reinterpret_cast<Complex*>(actual.data()), size};
+        REQUIRE(neo::allclose(expected.to_mdspan(), interleaved, Float(0)));
+    }
+
+    SECTION("split")
+    {
+        auto buf = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{2, size};
+        auto z   = neo::split_complex{
+            stdex::submdspan(buf.to_mdspan(), 0, stdex::full_extent),
+            stdex::submdspan(buf.to_mdspan(), 1, stdex::full_extent),
+        };
+        for (auto i{0U}; i < size; ++i) {
+            z.real[i] = noise(i).real();
+            z.imag[i] = noise(i).imag();
+        }
+
+        plan(z);
+        auto mismatch = std::size_t{0};
+        for (auto i{0U}; i < size; ++i) {
+            mismatch += static_cast<std::size_t>(z.real[i] != expected(i).real() or z.imag[i] != expected(i).imag());
+        }
+        REQUIRE(mismatch == 0);
+    }
+}
+
 #if defined(NEO_HAS_APPLE_ACCELERATE)
 TEMPLATE_TEST_CASE("neo/fft: apple_vdsp_fft_plan", "", neo::complex64, std::complex<float>, neo::complex128, std::complex<double>)
 {
@@ -243,6 +343,44 @@ TEMPLATE_PRODUCT_TEST_CASE(
     test_fft_plan<typename TestType::plan_type>();
 }
 
+TEMPLATE_TEST_CASE("neo/fft: c2c_four_step_plan", "", neo::complex64, std::complex<float>, neo::complex128, std::complex<double>)
+{
+    test_fft_plan<neo::fft::c2c_four_step_plan<TestType>>();
+}
+
+TEMPLATE_TEST_CASE("neo/fft: c2c_four_step_plan(thread_pool)", "", std::complex<float>, std::complex<double>)
+{
+    using Complex = TestType;
+    using Float   = typename Complex::value_type;
+
+    auto const num_threads = GENERATE(as<std::size_t>{}, 1, 2, 3, 4);
+    auto const order       = GENERATE(as<std::size_t>{}, 2, 3, 7, 15, 16);
+    CAPTURE(num_threads);
+    CAPTURE(order);
+
+    auto pool = neo::thread_pool{num_threads};
+    REQUIRE(pool.num_threads() == num_threads);
+
+    auto plan      = neo::fft::c2c_four_step_plan<Complex>{neo::fft::from_order, order, pool};
+    auto reference = neo::fft::c2c_dit2_plan<Complex>{neo::fft::from_order, order};
+    REQUIRE(plan.size() == reference.size());
+
+    auto const noise = neo::generate_noise_signal<Complex>(plan.size(), Catch::getSeed());
+
+    auto expected = noise;
+    neo::fft::fft(reference, expected.to_mdspan());
+
+    auto actual = noise;
+    neo::fft::fft(plan, actual.to_mdspan());
+
+    auto const tolerance = std::same_as<Float, float> ? Float(1e-2) : Float(1e-8);
+    REQUIRE(neo::allclose(expected.to_mdspan(), actual.to_mdspan(), tolerance));
+
+    neo::fft::ifft(plan, actual.to_mdspan());
+    neo::scale(Float(1) / static_cast<Float>(plan.size()), actual.to_mdspan());
+    REQUIRE(neo::allclose(noise.to_mdspan(), actual.to_mdspan()));
+}
+
 #if defined(NEO_HAS_XSIMD)
 TEMPLATE_PRODUCT_TEST_CASE(
     "neo/fft: c2c_dit2_plan",
@@ -0,0 +1,303 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/algorithm/fill.hpp>
+#include <neo/complex/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fft/order.hpp>
+#include <neo/fft/rfft.hpp>
+#include <neo/fft/rfftfreq.hpp>
+#include <neo/fft/stft_processor.hpp>
+#include <neo/math/a_weighting.hpp>
+#include <neo/math/abs.hpp>
+#include <neo/math/conj.hpp>
+#include <neo/math/real.hpp>
+#include <neo/math/windowing.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace neo::fft {
+
+/// \brief Streaming, frequency-weighted error between a reference and a test signal.
+///
+/// Accepts blocks of any size. Every hop_size() samples the last frame_size()
+/// samples of both signals are windowed and transformed, only the running sums
+/// are kept, so the memory use is independent of the signal length. An
+/// incomplete last hop is ignored. Four metrics are accumulated:
+///
+/// - a_weighted_error: A-weighted energy of the spectral difference relative to
+///   the A-weighted energy of the reference, in dB.
+/// - loudness_normalized_error: like a_weighted_error, but the test signal is
+///   first scaled to the A-weighted energy of the reference, so a plain gain
+///   change is not rated.
+/// - log_spectral_distance: RMS difference of the log power spectra in dB,
+///   averaged over all non-silent frames.
+/// - segmental_snr: time-domain SNR of each hop, clamped to [-10, 35] dB and
+///   averaged over all non-silent hops.
+///
+/// \ingroup neo-fft
+template<std::floating_point Float, complex Complex = std::complex<Float>>
+struct perceptual_error
+{
+    using real_type    = Float;
+    using complex_type = Complex;
+    using size_type    = std::size_t;
+
+    perceptual_error(from_order_tag /*tag*/, size_type order, double sample_rate, size_type hop_divisor = 2);
+
+    [[nodiscard]] auto frame_size() const noexcept -> size_type;
+    [[nodiscard]] auto hop_size() const noexcept -> size_type;
+    [[nodiscard]] auto num_bins() const noexcept -> size_type;
+
+    /// Number of analyzed frames, including silent ones.
+    [[nodiscard]] auto num_frames() const noexcept -> size_type;
+
+    /// Returns -inf if the signals are identical.
+    [[nodiscard]] auto a_weighted_error() const noexcept -> Float;
+    /// Ignores a constant gain difference between the signals.
+    [[nodiscard]] auto loudness_normalized_error() const noexcept -> Float;
+    [[nodiscard]] auto log_spectral_distance() const noexcept -> Float;
+    [[nodiscard]] auto segmental_snr() const noexcept -> Float;
+
+    auto reset() noexcept -> void;
+
+    template<in_vector InVecRef, in_vector InVecTest>
+    auto operator()(InVecRef reference, InVecTest test) -> void;
+
+private:
+    /// Frames or hops with a mean power below -70 dBFS are not rated.
+    static constexpr auto const silence = 1e-7;
+    static constexpr auto const min_snr = -10.0;
+    static constexpr auto const max_snr = 35.0;
+
+    template<in_matrix Frames>
+    auto process_frame(Frames frames) -> void;
+
+    rfft_plan<Float, Complex> _rfft;
+    detail::stft_frames<Float> _frames;
+
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _window{_rfft.size()};
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _weights{_rfft.size() / 2 + 1};
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _frame{_rfft.size()};
+    stdex::mdarray<Complex, stdex::dextents<size_type, 2>> _spectrum{2, _rfft.size() / 2 + 1};
+
+    // Hour-long renders sum up millions of frames, double keeps the totals exact enough
+    size_type _num_frames{0};
+    double _weighted_error{0};
+    double _weighted_energy{0};
+    double _weighted_test_energy{0};
+    double _weighted_cross_energy{0};
+    double _lsd_sum{0};
+    size_type _lsd_frames{0};
+    double _snr_sum{0};
+    size_type _snr_segments{0};
+};
+
+template<std::floating_point Float, complex Complex>
+perceptual_error<Float, Complex>::perceptual_error(
+    from_order_tag /*tag*/,
+    size_type order,
+    double sample_rate,
+    size_type hop_divisor
+)
+    : _rfft{from_order, order}
+    , _frames{order, 2, hop_divisor}
+{
+    fill_window(_window.to_mdspan(), hann_window<Float>{});
+
+    // a_weighting is undefined at DC, which is inaudible anyway
+    _weights(0) = Float(0);
+    for (auto bin = size_type(1); bin < num_bins(); ++bin) {
+        auto const frequency = rfftfreq<Float>(frame_size(), bin, 1.0 / sample_rate);
+        _weights(bin)        = std::pow(Float(10), a_weighting(frequency) / Float(10));
+    }
+
+    reset();
+}
+
+template<std::floating_point Float, complex Complex>
+auto perceptual_error<Float, Complex>::frame_size() const noexcept -> size_type
+{
+    return _rfft.size();
+}
+
+template<std::floating_point Float, complex Complex>
+auto perceptual_error<Float, Complex>::hop_size() const noexcept -> size_type
+{
+    return _frames.hop_size();
+}
+
+template<std::floating_point Float, complex Complex>
+auto perceptual_error<Float, Complex>::num_bins() const noexcept -> size_type
+{
+    return frame_size() / 2 + 1;
+}
+
+template<std::floating_point Float, complex Complex>
+auto perceptual_error<Float, Complex>::num_frames() const noexcept -> size_type
+{
+    return _num_frames;
+}
+
+template<std::floating_point Float, complex Complex>
+auto perceptual_error<Float, Complex>::a_weighted_error() const noexcept -> Float
+{
+    if (_weighted_error <= 0.0) {
+        return -std::numeric_limits<Float>::infinity();
+    }
+    if (_weighted_energy <= 0.0) {
+        return std::numeric_limits<Float>::infinity();
+    }
+    return static_cast<Float>(10.0 * std::log10(_weighted_error / _weighted_energy));
+}
+
+template<std::floating_point Float, complex Complex>
+auto perceptual_error<Float, Complex>::loudness_normalized_error() const noexcept -> Float
+{
+    if (_weighted_energy <= 0.0 and _weighted_test_energy <= 0.0) {
+        return -std::numeric_limits<Float>::infinity();
+    }
+    if (_weighted_energy <= 0.0 or _weighted_test_energy <= 0.0) {
+        return std::numeric_limits<Float>::infinity();
+    }
+
+    // |R - g*T|^2 with g = sqrt(|R|^2 / |T|^2) expands to 2 * (|R|^2 - g * Re(conj(R) * T))
+    auto const gain  = std::sqrt(_weighted_energy / _weighted_test_energy);
+    auto const error = 2.0 * (_weighted_energy - gain * _weighted_cross_energy);
+    if (error <= 0.0) {
+        return -std::numeric_limits<Float>::infinity();
+    }
+    return static_cast<Float>(10.0 * std::log10(error / _weighted_energy));
+}
+
+template<std::floating_point Float, complex Complex>
+auto perceptual_error<Float, Complex>::log_spectral_distance() const noexcept -> Float
+{
+    if (_lsd_frames == 0) {
+        return Float(0);
+    }
+    return static_cast<Float>(_lsd_sum / static_cast<double>(_lsd_frames));
+}
+
+template<std::floating_point Float, complex Complex>
+auto perceptual_error<Float, Complex>::segmental_snr() const noexcept -> Float
+{
+    if (_snr_segments == 0) {
+        return static_cast<Float>(max_snr);
+    }
+    return static_cast<Float>(_snr_sum / static_cast<double>(_snr_segments));
+}
+
+template<std::floating_point Float, complex Complex>
+auto perceptual_error<Float, Complex>::reset() noexcept -> void
+{
+    _frames.reset();
+    _num_frames            = 0;
+    _weighted_error        = 0.0;
+    _weighted_energy       = 0.0;
+    _weighted_test_energy  = 0.0;
+    _weighted_cross_energy = 0.0;
+    _lsd_sum               = 0.0;
+    _lsd_frames            = 0;
+    _snr_sum               = 0.0;
+    _snr_segments          = 0;
+}
+
+template<std::floating_point Float, complex Complex>
+template<in_vector InVecRef, in_vector InVecTest>
+auto perceptual_error<Float, Complex>::operator()(InVecRef reference, InVecTest test) -> void
+{
+    assert(reference.extents() == test.extents());
+
+    auto const num_samples = static_cast<size_type>(reference.extent(0));
+
+    auto exchange = [reference, test](size_type first, size_type /*position*/, auto slots) {
+        for (auto i = size_type(0); i < slots.extent(1); ++i) {
+            slots(0, i) = static_cast<Float>(reference[first + i]);
+            slots(1, i) = static_cast<Float>(test[first + i]);
+        }
+    };
+
+    _frames(num_samples, exchange, [this](auto frames) { process_frame(frames); });
+}
+
+template<std::floating_point Float, complex Complex>
+template<in_matrix Frames>
+auto perceptual_error<Float, Complex>::process_frame(Frames input) -> void
+{
+    auto const size     = frame_size();
+    auto const hop      = hop_size();
+    auto const bins     = num_bins();
+    auto const frame    = _frame.to_mdspan();
+    auto const spectrum = _spectrum.to_mdspan();
+    auto const window   = _window.to_mdspan();
+    auto const weights  = _weights.to_mdspan();
+
+    ++_num_frames;
+
+    // Segmental SNR over the hop that just arrived, so every sample is rated once
+    auto signal = 0.0;
+    auto noise  = 0.0;
+    for (auto i = size - hop; i < size; ++i) {
+        auto const ref   = static_cast<double>(input(0, i));
+        auto const error = static_cast<double>(input(1, i)) - ref;
+        signal += ref * ref;
+        noise += error * error;
+    }
+    if (signal / static_cast<double>(hop) > silence) {
+        auto const snr = noise > 0.0 ? 10.0 * std::log10(signal / noise) : max_snr;
+        _snr_sum += std::clamp(snr, min_snr, max_snr);
+        ++_snr_segments;
+    }
+
+    auto frame_power = 0.0;
+    for (auto i = size_type(0); i < size; ++i) {
+        frame_power += static_cast<double>(input(0, i)) * static_cast<double>(input(0, i));
+    }
+    frame_power /= static_cast<double>(size);
+
+    for (auto ch = size_type(0); ch < 2; ++ch) {
+        for (auto i = size_type(0); i < size; ++i) {
+            frame[i] = input(ch, i) * window[i];
+        }
+        rfft(_rfft, frame, stdex::submdspan(spectrum, ch, stdex::full_extent));
+    }
+
+    auto reference_power = 0.0;
+    for (auto bin = size_type(0); bin < bins; ++bin) {
+        auto const ref    = spectrum(0, bin);
+        auto const test   = spectrum(1, bin);
+        auto const error  = test - ref;
+        auto const weight = static_cast<double>(weights[bin]);
+        auto const power  = static_cast<double>(math::abs(ref) * math::abs(ref));
+        auto const diff   = static_cast<double>(math::abs(error) * math::abs(error));
+
+        _weighted_energy += weight * power;
+        _weighted_error += weight * diff;
+        _weighted_test_energy += weight * static_cast<double>(math::abs(test) * math::abs(test));
+        _weighted_cross_energy += weight * static_cast<double>(math::real(math::conj(ref) * test));
+        reference_power += power;
+    }
+
+    // The floor sits 100 dB below the mean bin power, so near-empty bins don't dominate the distance
+    if (frame_power > silence) {
+        auto const floor = reference_power / static_cast<double>(bins) * 1e-10;
+        auto sum         = 0.0;
+        for (auto bin = size_type(0); bin < bins; ++bin) {
+            auto const ref  = static_cast<double>(math::abs(spectrum(0, bin)));
+            auto const test = static_cast<double>(math::abs(spectrum(1, bin)));
+            auto const db   = 10.0 * std::log10((ref * ref + floor) / (test * test + floor));
+            sum += db * db;
+        }
+
+        _lsd_sum += std::sqrt(sum / static_cast<double>(bins));
+        ++_lsd_frames;
+    }
+}
+
+}  // namespace neo::fft
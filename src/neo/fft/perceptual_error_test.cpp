@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+
+#include "perceptual_error.hpp"
+
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace {
+
+template<typename Metric>
+auto process_in_blocks(Metric& metric, neo::in_vector auto reference, neo::in_vector auto test, std::size_t block_size)
+{
+    auto const num_samples = static_cast<std::size_t>(reference.extent(0));
+    for (auto first = std::size_t(0); first < num_samples; first += block_size) {
+        auto const last = std::min(first + block_size, num_samples);
+        metric(
+            stdex::submdspan(reference, std::tuple{first, last}),
+            stdex::submdspan(test, std::tuple{first, last})
+        );
+    }
+}
+
+template<typename Float>
+auto sine(std::size_t size, double frequency, double sample_rate, Float gain)
+{
+    auto buf = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+    for (auto i = std::size_t(0); i < size; ++i) {
+        auto const phase = 2.0 * std::numbers::pi * frequency * static_cast<double>(i) / sample_rate;
+        buf(i)           = gain * static_cast<Float>(std::sin(phase));
+    }
+    return buf;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/fft: perceptual_error", "", float, double)
+{
+    using Float = TestType;
+
+    auto const order       = GENERATE(as<std::size_t>{}, 8, 10);
+    auto const hop_divisor = GENERATE(as<std::size_t>{}, 2, 4);
+    auto const sample_rate = 44100.0;
+    CAPTURE(order);
+    CAPTURE(hop_divisor);
+
+    auto const reference = neo::generate_noise_signal<Float>(8192, Catch::getSeed());
+
+    SECTION("identical")
+    {
+        auto metric = neo::fft::perceptual_error<Float>{neo::fft::from_order, order, sample_rate, hop_divisor};
+        REQUIRE(metric.frame_size() == std::size_t(1) << order);
+        REQUIRE(metric.hop_size() == metric.frame_size() / hop_divisor);
+        REQUIRE(metric.num_bins() == metric.frame_size() / 2 + 1);
+
+        metric(reference.to_mdspan(), reference.to_mdspan());
+        REQUIRE(metric.num_frames() == 8192 / metric.hop_size());
+        REQUIRE(std::isinf(metric.a_weighted_error()));
+        REQUIRE(metric.a_weighted_error() < Float(0));
+        REQUIRE(metric.loudness_normalized_error() < Float(-60));
+        REQUIRE(metric.log_spectral_distance() == Catch::Approx(0.0));
+        REQUIRE(metric.segmental_snr() == Catch::Approx(35.0));
+
+        metric.reset();
+        REQUIRE(metric.num_frames() == 0);
+    }
+
+    SECTION("gain")
+    {
+        // A constant gain error shows up as the same distance in every bin
+        auto test = reference;
+        for (auto i = std::size_t(0); i < test.extent(0); ++i) {
+            test(i) = reference(i) * Float(0.5);
+        }
+
+        auto metric = neo::fft::perceptual_error<Float>{neo::fft::from_order, order, sample_rate, hop_divisor};
+        metric(reference.to_mdspan(), test.to_mdspan());
+
+        auto const expected = 20.0 * std::log10(2.0);
+        REQUIRE(metric.log_spectral_distance() == Catch::Approx(expected).epsilon(0.01));
+        REQUIRE(metric.segmental_snr() == Catch::Approx(expected).epsilon(0.01));
+        REQUIRE(metric.a_weighted_error() == Catch::Approx(-expected).epsilon(0.01));
+
+        // Matching the loudness removes the gain error
+        REQUIRE(metric.loudness_normalized_error() < Float(-60));
+    }
+
+    SECTION("block size")
+    {
+        auto test = reference;
+        for (auto i = std::size_t(0); i < test.extent(0); i += 3) {
+            test(i) = Float(0);
+        }
+
+        auto whole = neo::fft::perceptual_error<Float>{neo::fft::from_order, order, sample_rate, hop_divisor};
+        whole(reference.to_mdspan(), test.to_mdspan());
+
+        auto const block_size = GENERATE(as<std::size_t>{}, 1, 63, 512);
+        auto blocks           = neo::fft::perceptual_error<Float>{
+            neo::fft::from_order,
+            order,
+            sample_rate,
+            hop_divisor,
+        };
+        process_in_blocks(blocks, reference.to_mdspan(), test.to_mdspan(), block_size);
+
+        REQUIRE(blocks.num_frames() == whole.num_frames());
+        REQUIRE(blocks.a_weighted_error() == Catch::Approx(whole.a_weighted_error()));
+        REQUIRE(blocks.loudness_normalized_error() == Catch::Approx(whole.loudness_normalized_error()));
+        REQUIRE(blocks.log_spectral_distance() == Catch::Approx(whole.log_spectral_distance()));
+        REQUIRE(blocks.segmental_snr() == Catch::Approx(whole.segmental_snr()));
+    }
+
+    SECTION("a-weighting")
+    {
+        // The same error energy is far less audible at 50 Hz than at 2 kHz
+        auto const low  = sine<Float>(8192, 50.0, sample_rate, Float(0.01));
+        auto const high = sine<Float>(8192, 2000.0, sample_rate, Float(0.01));
+
+        auto low_test  = reference;
+        auto high_test = reference;
+        for (auto i = std::size_t(0); i < reference.extent(0); ++i) {
+            low_test(i)  = reference(i) + low(i);
+            high_test(i) = reference(i) + high(i);
+        }
+
+        auto low_metric  = neo::fft::perceptual_error<Float>{neo::fft::from_order, order, sample_rate, hop_divisor};
+        auto high_metric = neo::fft::perceptual_error<Float>{neo::fft::from_order, order, sample_rate, hop_divisor};
+        low_metric(reference.to_mdspan(), low_test.to_mdspan());
+        high_metric(reference.to_mdspan(), high_test.to_mdspan());
+
+        REQUIRE(low_metric.a_weighted_error() + Float(10) < high_metric.a_weighted_error());
+        REQUIRE(low_metric.loudness_normalized_error() + Float(10) < high_metric.loudness_normalized_error());
+        REQUIRE(low_metric.segmental_snr() == Catch::Approx(high_metric.segmental_snr()).margin(0.5));
+    }
+
+    SECTION("silence")
+    {
+        auto const silence = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{4096};
+
+        auto metric = neo::fft::perceptual_error<Float>{neo::fft::from_order, order, sample_rate, hop_divisor};
+        metric(silence.to_mdspan(), silence.to_mdspan());
+        REQUIRE(metric.log_spectral_distance() == Catch::Approx(0.0));
+        REQUIRE(metric.segmental_snr() == Catch::Approx(35.0));
+    }
+}
+
+TEST_CASE("neo/fft: perceptual_error(invalid)")
+{
+    REQUIRE_THROWS(neo::fft::perceptual_error<float>{neo::fft::from_order, 8, 44100.0, 0});
+    REQUIRE_THROWS(neo::fft::perceptual_error<float>{neo::fft::from_order, 8, 44100.0, 3});
+    REQUIRE_THROWS(neo::fft::perceptual_error<float>{neo::fft::from_order, 2, 44100.0, 8});
+}
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fft/direction.hpp>
+#include <neo/fft/fft.hpp>
+#include <neo/fft/order.hpp>
+#include <neo/fft/rfft.hpp>
+#include <neo/fft/twiddle.hpp>
+#include <neo/math/conj.hpp>
+#include <neo/math/real.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace neo::fft {
+
+/// \brief Real FFT plan whose inverse can skip the bins above a known maximum.
+///
+/// Forward transforms and inverse transforms without a max_bin use the regular
+/// rfft_plan. With only the bins [0, max_bin] non-zero, the output of size N is
+/// out[m * P + p] = Re(sum_k c[k] * W_N^(p * k) * W_M^(m * k)), with
+/// M = bit_ceil(max_bin + 1), P = N / M, c[0] = X[0] and c[k] = 2 * X[k].
+/// So instead of one transform of size N, P transforms of size M are computed,
+/// which skips all butterflies of the first log2(P) stages that only see zeros.
+/// Since only the real part is needed, two of them are packed into one complex
+/// transform. Spectra with content at or above N/4 use the regular irfft. Like
+/// irfft, the output is not normalized.
+///
+/// \ingroup neo-fft
+template<std::floating_point Float, complex Complex = std::complex<Float>>
+struct pruned_rfft_plan
+{
+    using real_type    = Float;
+    using complex_type = Complex;
+    using size_type    = std::size_t;
+
+    pruned_rfft_plan(from_order_tag /*tag*/, size_type order);
+
+    [[nodiscard]] auto order() const noexcept -> size_type;
+    [[nodiscard]] auto size() const noexcept -> size_type;
+
+    template<in_vector_of<Float> InVec, out_vector_of<Complex> OutVec>
+    auto operator()(InVec in, OutVec out) -> void;
+
+    template<in_vector_of<Complex> InVec, out_vector_of<Float> OutVec>
+    auto operator()(InVec in, OutVec out) -> void;
+
+    /// Bins above \p max_bin must be zero.
+    template<in_vector_of<Complex> InVec, out_vector_of<Float> OutVec>
+    auto operator()(InVec in, OutVec out, size_type max_bin) -> void;
+
+private:
+    static constexpr auto const min_order = size_type{2};
+
+    rfft_plan<Float, Complex> _rfft;
+    std::vector<std::unique_ptr<fft_plan<Complex>>> _plans;
+    stdex::mdarray<Complex, stdex::dextents<size_type, 1>> _twiddles{_rfft.size()};
+    stdex::mdarray<Complex, stdex::dextents<size_type, 2>> _buffer{2, _rfft.size() / 4};
+};
+
+template<std::floating_point Float, complex Complex>
+pruned_rfft_plan<Float, Complex>::pruned_rfft_plan(from_order_tag /*tag*/, size_type order)
+    : _rfft{from_order, order}
+{
+    for (auto sub_order = min_order; sub_order + 2 <= order; ++sub_order) {
+        _plans.push_back(std::make_unique<fft_plan<Complex>>(from_order, sub_order));
+    }
+
+    for (auto i = size_type(0); i < size(); ++i) {
+        _twiddles(i) = twiddle<Complex>(size(), i, direction::backward);
+    }
+}
+
+template<std::floating_point Float, complex Complex>
+auto pruned_rfft_plan<Float, Complex>::order() const noexcept -> size_type
+{
+    return _rfft.order();
+}
+
+template<std::floating_point Float, complex Complex>
+auto pruned_rfft_plan<Float, Complex>::size() const noexcept -> size_type
+{
+    return _rfft.size();
+}
+
+template<std::floating_point Float, complex Complex>
+template<in_vector_of<Float> InVec, out_vector_of<Complex> OutVec>
+auto pruned_rfft_plan<Float, Complex>::operator()(InVec in, OutVec out) -> void
+{
+    rfft(_rfft, in, out);
+}
+
+template<std::floating_point Float, complex Complex>
+template<in_vector_of<Complex> InVec, out_vector_of<Float> OutVec>
+auto pruned_rfft_plan<Float, Complex>::operator()(InVec in, OutVec out) -> void
+{
+    irfft(_rfft, in, out);
+}
+
+template<std::floating_point Float, complex Complex>
+template<in_vector_of<Complex> InVec, out_vector_of<Float> OutVec>
+auto pruned_rfft_plan<Float, Complex>::operator()(InVec in, OutVec out, size_type max_bin) -> void
+{
+    assert(std::cmp_equal(out.extent(0), size()));
+    assert(max_bin <= size() / 2);
+
+    auto const sub_order = std::max(static_cast<size_type>(std::bit_width(max_bin)), min_order);
+    if (sub_order + 2 > order()) {
+        irfft(_rfft, in, out);
+        return;
+    }
+
+    auto& plan          = *_plans[sub_order - min_order];
+    auto const sub_size = fft::size(sub_order);
+    auto const stride   = size() / sub_size;
+    auto const twiddles = _twiddles.to_mdspan();
+    auto const a        = stdex::submdspan(_buffer.to_mdspan(), 0, std::tuple{size_type(0), sub_size});
+    auto const b        = stdex::submdspan(_buffer.to_mdspan(), 1, std::tuple{size_type(0), sub_size});
+
+    auto const dc = Float(math::real(in[0]));
+
+    for (auto p = size_type(0); p < stride; p += 2) {
+        for (auto k = size_type(1); k <= max_bin; ++k) {
+            a[k] = in[k] * twiddles[p * k];
+            b[k] = in[k] * twiddles[(p + 1) * k];
+        }
+        for (auto k = max_bin + 1; k < sub_size; ++k) {
+            a[k] = Complex{};
+            b[k] = Complex{};
+        }
+
+        // Hermitian parts of both sequences, so their transforms are real and
+        // end up in the real and imaginary part of a single transform
+        a[0] = Complex{dc, dc};
+        for (auto k = size_type(1); k <= sub_size / 2; ++k) {
+            auto const s1 = a[k] + math::conj(a[sub_size - k]);
+            auto const s2 = a[sub_size - k] + math::conj(a[k]);
+            auto const t1 = b[k] + math::conj(b[sub_size - k]);
+            auto const t2 = b[sub_size - k] + math::conj(b[k]);
+
+            a[k]            = Complex{s1.real() - t1.imag(), s1.imag() + t1.real()};
+            a[sub_size - k] = Complex{s2.real() - t2.imag(), s2.imag() + t2.real()};
+        }
+
+        plan(a, direction::backward);
+        for (auto m = size_type(0); m < sub_size; ++m) {
+            out[m * stride + p]     = a[m].real();
+            out[m * stride + p + 1] = a[m].imag();
+        }
+    }
+}
+
+}  // namespace neo::fft
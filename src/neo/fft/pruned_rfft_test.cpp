@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+
+#include "pruned_rfft.hpp"
+
+#include <neo/algorithm/allclose.hpp>
+#include <neo/algorithm/fill.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <complex>
+#include <tuple>
+
+TEMPLATE_TEST_CASE("neo/fft: pruned_rfft_plan", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const order = GENERATE(as<std::size_t>{}, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
+    CAPTURE(order);
+
+    auto rfft   = neo::fft::rfft_plan<Float, Complex>{neo::fft::from_order, order};
+    auto pruned = neo::fft::pruned_rfft_plan<Float, Complex>{neo::fft::from_order, order};
+    REQUIRE(pruned.order() == order);
+    REQUIRE(pruned.size() == rfft.size());
+
+    auto const num_bins = rfft.size() / 2 + 1;
+    auto const signal   = neo::generate_noise_signal<Float>(rfft.size(), Catch::getSeed());
+    auto spectrum       = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{num_bins};
+    neo::fft::rfft(rfft, signal.to_mdspan(), spectrum.to_mdspan());
+
+    auto expected = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{rfft.size()};
+    auto output   = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{rfft.size()};
+
+    for (auto max_bin : {std::size_t(0), std::size_t(1), std::size_t(3), num_bins / 8, num_bins / 4, num_bins - 1}) {
+        if (max_bin >= num_bins) {
+            continue;
+        }
+        CAPTURE(max_bin);
+
+        auto band_limited = spectrum;
+        neo::fill(stdex::submdspan(band_limited.to_mdspan(), std::tuple{max_bin + 1, num_bins}), Complex{});
+        neo::fft::irfft(rfft, band_limited.to_mdspan(), expected.to_mdspan());
+
+        // Unnormalized, so the error grows with the size
+        pruned(band_limited.to_mdspan(), output.to_mdspan(), max_bin);
+        REQUIRE(neo::allclose(output.to_mdspan(), expected.to_mdspan(), Float(1e-5) * Float(rfft.size())));
+    }
+}
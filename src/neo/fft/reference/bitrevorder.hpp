@@ -7,65 +7,146 @@
 #include <neo/complex/split_complex.hpp>
 #include <neo/container/mdspan.hpp>
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <span>
 #include <utility>
 #include <vector>
 
 namespace neo::fft {
 
-/// Reorder input using bit reversal permutation.
+/// \brief Reorder input using bit reversal permutation.
+///
+/// Small orders use a full index table. Large orders split each index into
+/// (high, middle, low) bits with a high & low width of block_order. The reversed
+/// index is (rev(low), rev(middle), rev(high)), so the middle bit patterns b
+/// and rev(b) exchange a BxB tile. Both tiles are copied into a small buffer
+/// and written back transposed, so every access to the array is a contiguous
+/// run of B elements instead of a random access. The table only needs the
+/// reversal of the middle bits, which is N / B^2 entries instead of N.
+///
 /// \ingroup neo-fft
 struct bitrevorder_plan
 {
-    explicit bitrevorder_plan(std::size_t order) : _table{make(std::size_t(1) << order)} {}
+    explicit bitrevorder_plan(std::size_t order)
+        : _order{order}
+        , _table{make(order < blocked_min_order ? order : order - 2 * block_order)}
+    {}
 
     template<inout_vector Vec>
         requires complex<value_type_t<Vec>>
     auto operator()(Vec x) -> void
     {
-        for (auto i{0U}; i < _table.size(); ++i) {
-            if (i < _table[i]) {
-                std::swap(x[i], x[_table[i]]);
-            }
-        }
+        permute<value_type_t<Vec>>(
+            [x](std::size_t i) { return x[i]; },
+            [x](std::size_t i, auto const& val) { x[i] = val; },
+            [x](std::size_t i, std::size_t j) { std::swap(x[i], x[j]); }
+        );
     }
 
     template<inout_vector Vec>
         requires std::floating_point<value_type_t<Vec>>
     auto operator()(Vec x) -> void
     {
-        for (auto i{0U}; i < _table.size(); ++i) {
-            if (i < _table[i]) {
-                auto const src_re = i * 2U;
-                auto const src_im = src_re + 1U;
-
-                auto const dest_re = _table[i] * 2U;
-                auto const dest_im = dest_re + 1U;
-
-                std::swap(x[src_re], x[dest_re]);
-                std::swap(x[src_im], x[dest_im]);
+        using Float = value_type_t<Vec>;
+
+        permute<std::array<Float, 2>>(
+            [x](std::size_t i) { return std::array{x[i * 2U], x[i * 2U + 1U]}; },
+            [x](std::size_t i, auto const& val) {
+                x[i * 2U]      = val[0];
+                x[i * 2U + 1U] = val[1];
+            },
+            [x](std::size_t i, std::size_t j) {
+                std::swap(x[i * 2U], x[j * 2U]);
+                std::swap(x[i * 2U + 1U], x[j * 2U + 1U]);
             }
-        }
+        );
     }
 
     template<inout_vector Vec>
     auto operator()(split_complex<Vec> x) -> void
     {
-        for (auto i{0U}; i < _table.size(); ++i) {
-            auto const other_idx = _table[i];
-            if (i < other_idx) {
-                std::swap(x.real[i], x.real[other_idx]);
-                std::swap(x.imag[i], x.imag[other_idx]);
+        using Float = value_type_t<Vec>;
+
+        permute<std::array<Float, 2>>(
+            [x](std::size_t i) { return std::array{x.real[i], x.imag[i]}; },
+            [x](std::size_t i, auto const& val) {
+                x.real[i] = val[0];
+                x.imag[i] = val[1];
+            },
+            [x](std::size_t i, std::size_t j) {
+                std::swap(x.real[i], x.real[j]);
+                std::swap(x.imag[i], x.imag[j]);
             }
-        }
+        );
     }
 
 private:
-    [[nodiscard]] static auto make(std::size_t size) -> std::vector<std::uint32_t>
+    static constexpr auto block_order       = std::size_t{5};
+    static constexpr auto block_size        = std::size_t{1} << block_order;
+    static constexpr auto blocked_min_order = std::size_t{16};
+
+    template<typename T, typename Load, typename Store, typename Swap>
+    auto permute(Load load, Store store, Swap swap) const -> void
     {
-        auto const order = bit_log2(size);
-        auto table       = std::vector<std::uint32_t>(size, 0);
+        if (_order < blocked_min_order) {
+            for (auto i{0U}; i < _table.size(); ++i) {
+                if (i < _table[i]) {
+                    swap(i, _table[i]);
+                }
+            }
+            return;
+        }
+
+        static constexpr auto const rev = make_block_table();
+
+        // Copies the tile of a middle bit pattern into the buffer, row by row
+        auto const high_shift = _order - block_order;
+        auto const load_tile  = [high_shift, load](std::size_t mid, auto& tile) {
+            for (auto high = std::size_t{0}; high < block_size; ++high) {
+                auto const row = (high << high_shift) | (mid << block_order);
+                for (auto low = std::size_t{0}; low < block_size; ++low) {
+                    tile[high * block_size + low] = load(row | low);
+                }
+            }
+        };
+
+        // Writes the tile to the reversed middle bit pattern, element (h, l) goes to (rev(l), rev(h))
+        auto const store_tile = [high_shift, store](std::size_t mid, auto const& tile) {
+            for (auto high = std::size_t{0}; high < block_size; ++high) {
+                auto const row = (high << high_shift) | (mid << block_order);
+                for (auto low = std::size_t{0}; low < block_size; ++low) {
+                    store(row | low, tile[rev[low] * block_size + rev[high]]);
+                }
+            }
+        };
+
+        auto tile     = std::array<T, block_size * block_size>{};
+        auto rev_tile = std::array<T, block_size * block_size>{};
+
+        for (auto mid = std::size_t{0}; mid < _table.size(); ++mid) {
+            auto const rev_mid = std::size_t{_table[mid]};
+            if (rev_mid < mid) {
+                continue;
+            }
+
+            load_tile(mid, tile);
+            if (rev_mid == mid) {
+                store_tile(mid, tile);
+                continue;
+            }
+
+            load_tile(rev_mid, rev_tile);
+            store_tile(rev_mid, tile);
+            store_tile(mid, rev_tile);
+        }
+    }
+
+    [[nodiscard]] static auto make(std::size_t order) -> std::vector<std::uint32_t>
+    {
+        auto const size = std::size_t(1) << order;
+        auto table      = std::vector<std::uint32_t>(size, 0);
         for (auto i{0U}; i < size; ++i) {
             for (auto j{0U}; j < order; ++j) {
                 table[i] |= ((i >> j) & 1) << (order - 1 - j);
@@ -74,6 +155,18 @@ private:
         return table;
     }
 
+    [[nodiscard]] static constexpr auto make_block_table() -> std::array<std::uint8_t, block_size>
+    {
+        auto table = std::array<std::uint8_t, block_size>{};
+        for (auto i{0U}; i < block_size; ++i) {
+            for (auto j{0U}; j < block_order; ++j) {
+                table[i] |= static_cast<std::uint8_t>(((i >> j) & 1U) << (block_order - 1 - j));
+            }
+        }
+        return table;
+    }
+
+    std::size_t _order;
     std::vector<std::uint32_t> _table;
 };
 
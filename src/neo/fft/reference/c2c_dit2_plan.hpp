@@ -11,6 +11,7 @@
 #include <neo/fft/twiddle.hpp>
 #include <neo/math/polar.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <numbers>
 
@@ -36,6 +37,14 @@ struct c2c_dit2_plan
         requires std::same_as<typename Vec::value_type, Complex>
     auto operator()(Vec x, direction dir) noexcept -> void;
 
+    /// Transforms each row of x. The rows are processed in tiles that fit
+    /// into the cache. If the rows are interleaved, e.g. layout_left, the
+    /// twiddle loads are shared within a tile, otherwise each row is
+    /// transformed on its own.
+    template<inout_matrix Mat>
+        requires std::same_as<typename Mat::value_type, Complex>
+    auto operator()(Mat x, direction dir) noexcept -> void;
+
 private:
     [[nodiscard]] static auto check_order(size_type order) -> size_type;
 
@@ -94,6 +103,43 @@ auto c2c_dit2_plan<Complex, Kernel>::operator()(Vec x, direction dir) noexcept -
     }
 }
 
+template<typename Complex, typename Kernel>
+template<inout_matrix Mat>
+    requires std::same_as<typename Mat::value_type, Complex>
+auto c2c_dit2_plan<Complex, Kernel>::operator()(Mat x, direction dir) noexcept -> void
+{
+    assert(std::cmp_equal(x.extent(1), _size));
+
+    static constexpr auto const tile_bytes = size_type{256 * 1024};
+
+    auto const num_rows  = static_cast<size_type>(x.extent(0));
+    auto const tile_size = std::clamp(tile_bytes / (_size * sizeof(Complex)), size_type{1}, size_type{64});
+    auto const twiddles  = dir == direction::forward ? _wf.to_mdspan() : _wb.to_mdspan();
+    auto const kernel    = Kernel{};
+
+    for (auto first{size_type{0}}; first < num_rows; first += tile_size) {
+        auto const last = std::min(first + tile_size, num_rows);
+        auto const tile = stdex::submdspan(x, std::tuple{first, last}, stdex::full_extent);
+
+        for (auto row{size_type{0}}; row < tile.extent(0); ++row) {
+            _reorder(stdex::submdspan(tile, row, stdex::full_extent));
+        }
+
+        // The batched kernel walks the rows in its innermost loop, that only pays off if they are adjacent
+        // in memory. With contiguous rows, e.g. layout_right, it would stride by the transform size.
+        if constexpr (requires { kernel(tile, twiddles); }) {
+            if (tile.stride(0) < tile.stride(1)) {
+                kernel(tile, twiddles);
+                continue;
+            }
+        }
+
+        for (auto row{size_type{0}}; row < tile.extent(0); ++row) {
+            kernel(stdex::submdspan(tile, row, stdex::full_extent), twiddles);
+        }
+    }
+}
+
 template<typename Complex, typename Kernel>
 auto c2c_dit2_plan<Complex, Kernel>::check_order(size_type order) -> size_type
 {
@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/algorithm/copy.hpp>
+#include <neo/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/execution/thread_pool.hpp>
+#include <neo/fft/direction.hpp>
+#include <neo/fft/order.hpp>
+#include <neo/fft/reference/c2c_dit2_plan.hpp>
+#include <neo/fft/twiddle.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace neo::fft {
+
+/// \brief C2C six-step FFT for large sizes
+///
+/// The input of size N = N1 * N2 is viewed as a N1 x N2 matrix. It is
+/// transposed, N2 transforms of size N1 are computed on the rows, the rows are
+/// multiplied by twiddles, transposed again, N1 transforms of size N2 are
+/// computed and a final transposition brings the result into natural order.
+/// Each sub-transform fits into the cache, and all steps are spread over the
+/// threads of an optional thread_pool. Every thread uses its own SubPlan
+/// instances, so SubPlan does not need to be thread-safe.
+///
+/// \ingroup neo-fft
+template<typename Complex, typename SubPlan = c2c_dit2_plan<Complex>>
+struct c2c_four_step_plan
+{
+    using value_type = Complex;
+    using size_type  = std::size_t;
+
+    c2c_four_step_plan(from_order_tag /*tag*/, size_type order);
+    c2c_four_step_plan(from_order_tag /*tag*/, size_type order, thread_pool& pool);
+
+    [[nodiscard]] static constexpr auto max_order() noexcept -> size_type;
+    [[nodiscard]] static constexpr auto max_size() noexcept -> size_type;
+
+    [[nodiscard]] auto order() const noexcept -> size_type;
+    [[nodiscard]] auto size() const noexcept -> size_type;
+
+    template<inout_vector Vec>
+        requires std::same_as<typename Vec::value_type, Complex>
+    auto operator()(Vec x, direction dir) -> void;
+
+private:
+    using matrix_type = stdex::mdspan<Complex, stdex::dextents<size_type, 2>>;
+
+    [[nodiscard]] static auto check_order(size_type order) -> size_type;
+
+    [[nodiscard]] auto num_chunks() const noexcept -> size_type;
+
+    template<typename Func>
+    auto for_each_chunk(size_type count, Func func) -> void;
+
+    template<in_matrix InMat, out_matrix OutMat>
+    auto transpose(InMat in, OutMat out) -> void;
+
+    template<inout_matrix Mat>
+    auto transform_rows(Mat x, std::vector<SubPlan>& plans, direction dir) -> void;
+
+    auto multiply_twiddles(matrix_type x, direction dir) -> void;
+
+    size_type _order;
+    size_type _size{fft::size(_order)};
+    size_type _order1{_order / 2};
+    size_type _order2{_order - _order1};
+    size_type _size1{fft::size(_order1)};
+    size_type _size2{fft::size(_order2)};
+
+    thread_pool* _pool{nullptr};
+    std::vector<SubPlan> _plans1;
+    std::vector<SubPlan> _plans2;
+
+    // W_N^j for j < N1 and W_N2^j for j < N2, forward and backward
+    stdex::mdarray<Complex, stdex::dextents<size_type, 2>> _tw1{2, _size1};
+    stdex::mdarray<Complex, stdex::dextents<size_type, 2>> _tw2{2, _size2};
+
+    stdex::mdarray<Complex, stdex::dextents<size_type, 1>> _buffer{_size};
+};
+
+template<typename Complex, typename SubPlan>
+c2c_four_step_plan<Complex, SubPlan>::c2c_four_step_plan(from_order_tag /*tag*/, size_type order)
+    : _order{check_order(order)}
+{
+    _plans1.emplace_back(from_order, _order1);
+    _plans2.emplace_back(from_order, _order2);
+
+    for (auto i = size_type{0}; i < _size1; ++i) {
+        _tw1(0, i) = twiddle<Complex>(_size, i, direction::forward);
+        _tw1(1, i) = twiddle<Complex>(_size, i, direction::backward);
+    }
+    for (auto i = size_type{0}; i < _size2; ++i) {
+        _tw2(0, i) = twiddle<Complex>(_size2, i, direction::forward);
+        _tw2(1, i) = twiddle<Complex>(_size2, i, direction::backward);
+    }
+}
+
+template<typename Complex, typename SubPlan>
+c2c_four_step_plan<Complex, SubPlan>::c2c_four_step_plan(from_order_tag tag, size_type order, thread_pool& pool)
+    : c2c_four_step_plan{tag, order}
+{
+    _pool = &pool;
+
+    _plans1.reserve(pool.num_threads());
+    _plans2.reserve(pool.num_threads());
+    while (_plans1.size() < pool.num_threads()) {
+        _plans1.emplace_back(from_order, _order1);
+        _plans2.emplace_back(from_order, _order2);
+    }
+}
+
+template<typename Complex, typename SubPlan>
+constexpr auto c2c_four_step_plan<Complex, SubPlan>::max_order() noexcept -> size_type
+{
+    return size_type{30};
+}
+
+template<typename Complex, typename SubPlan>
+constexpr auto c2c_four_step_plan<Complex, SubPlan>::max_size() noexcept -> size_type
+{
+    return fft::size(max_order());
+}
+
+template<typename Complex, typename SubPlan>
+auto c2c_four_step_plan<Complex, SubPlan>::order() const noexcept -> size_type
+{
+    return _order;
+}
+
+template<typename Complex, typename SubPlan>
+auto c2c_four_step_plan<Complex, SubPlan>::size() const noexcept -> size_type
+{
+    return _size;
+}
+
+template<typename Complex, typename SubPlan>
+template<inout_vector Vec>
+    requires std::same_as<typename Vec::value_type, Complex>
+auto c2c_four_step_plan<Complex, SubPlan>::operator()(Vec x, direction dir) -> void
+{
+    assert(std::cmp_equal(x.size(), _size));
+
+    // x as N1 x N2 matrix
+    auto const matrix = [this, x] {
+        if constexpr (has_layout_left_or_right<Vec>) {
+            return matrix_type{x.data_handle(), _size1, _size2};
+        } else {
+            auto const stride = static_cast<size_type>(x.stride(0));
+            auto const exts   = stdex::dextents<size_type, 2>{_size1, _size2};
+            auto const map    = stdex::layout_stride::mapping{exts, std::array{_size2 * stride, stride}};
+            return stdex::mdspan{x.data_handle(), map};
+        }
+    }();
+
+    auto const buf     = _buffer.to_mdspan();
+    auto const columns = matrix_type{buf.data_handle(), _size2, _size1};
+
+    // 1. Transform the N2 columns of length N1 and apply the twiddles
+    transpose(matrix, columns);
+    transform_rows(columns, _plans1, dir);
+    multiply_twiddles(columns, dir);
+
+    // 2. Transform the N1 rows of length N2
+    transpose(columns, matrix);
+    transform_rows(matrix, _plans2, dir);
+
+    // 3. Transpose into natural order
+    transpose(matrix, columns);
+    copy(buf, x);
+}
+
+template<typename Complex, typename SubPlan>
+auto c2c_four_step_plan<Complex, SubPlan>::check_order(size_type order) -> size_type
+{
+    if (order > max_order()) {
+        throw std::runtime_error{"four_step: unsupported order '" + std::to_string(int(order)) + "'"};
+    }
+    return order;
+}
+
+template<typename Complex, typename SubPlan>
+auto c2c_four_step_plan<Complex, SubPlan>::num_chunks() const noexcept -> size_type
+{
+    return _plans1.size();
+}
+
+template<typename Complex, typename SubPlan>
+template<typename Func>
+auto c2c_four_step_plan<Complex, SubPlan>::for_each_chunk(size_type count, Func func) -> void
+{
+    auto const chunks = std::min(num_chunks(), count);
+    auto const task   = [count, chunks, &func](size_type chunk) {
+        func(chunk, count * chunk / chunks, count * (chunk + 1) / chunks);
+    };
+
+    if (_pool != nullptr) {
+        _pool->parallel_for(chunks, task);
+    } else {
+        for (auto chunk = size_type{0}; chunk < chunks; ++chunk) {
+            task(chunk);
+        }
+    }
+}
+
+template<typename Complex, typename SubPlan>
+template<in_matrix InMat, out_matrix OutMat>
+auto c2c_four_step_plan<Complex, SubPlan>::transpose(InMat in, OutMat out) -> void
+{
+    static constexpr auto const block = size_type{32};
+
+    auto const rows = static_cast<size_type>(in.extent(0));
+    auto const cols = static_cast<size_type>(in.extent(1));
+
+    for_each_chunk(rows, [=](size_type /*chunk*/, size_type first, size_type last) {
+        for (auto ib{first}; ib < last; ib += block) {
+            auto const ie = std::min(ib + block, last);
+            for (auto jb = size_type{0}; jb < cols; jb += block) {
+                auto const je = std::min(jb + block, cols);
+                for (auto i{ib}; i < ie; ++i) {
+                    for (auto j{jb}; j < je; ++j) {
+                        out(j, i) = in(i, j);
+                    }
+                }
+            }
+        }
+    });
+}
+
+template<typename Complex, typename SubPlan>
+template<inout_matrix Mat>
+auto c2c_four_step_plan<Complex, SubPlan>::transform_rows(Mat x, std::vector<SubPlan>& plans, direction dir) -> void
+{
+    for_each_chunk(x.extent(0), [x, &plans, dir](size_type chunk, size_type first, size_type last) {
+        auto& plan      = plans[chunk];
+        auto const rows = stdex::submdspan(x, std::tuple{first, last}, stdex::full_extent);
+
+        if constexpr (requires { plan(rows, dir); }) {
+            plan(rows, dir);
+        } else {
+            for (auto row = size_type{0}; row < rows.extent(0); ++row) {
+                plan(stdex::submdspan(rows, row, stdex::full_extent), dir);
+            }
+        }
+    });
+}
+
+template<typename Complex, typename SubPlan>
+auto c2c_four_step_plan<Complex, SubPlan>::multiply_twiddles(matrix_type x, direction dir) -> void
+{
+    auto const tw1 = stdex::submdspan(_tw1.to_mdspan(), dir == direction::forward ? 0 : 1, stdex::full_extent);
+    auto const tw2 = stdex::submdspan(_tw2.to_mdspan(), dir == direction::forward ? 0 : 1, stdex::full_extent);
+
+    auto const mask  = _size1 - 1;
+    auto const shift = _order1;
+
+    // x(n2, k1) *= W_N^(n2 * k1) = W_N^(lo) * W_N2^(hi), with n2 * k1 = hi * N1 + lo
+    for_each_chunk(x.extent(0), [=](size_type /*chunk*/, size_type first, size_type last) {
+        for (auto n2{first}; n2 < last; ++n2) {
+            for (auto k1 = size_type{1}; k1 < x.extent(1); ++k1) {
+                auto const e = n2 * k1;
+                x(n2, k1)    = x(n2, k1) * (tw1[e & mask] * tw2[e >> shift]);
+            }
+        }
+    });
+}
+
+}  // namespace neo::fft
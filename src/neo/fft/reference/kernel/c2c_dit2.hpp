@@ -165,6 +165,55 @@ struct c2c_dit2_v3
             }
         }
     }
+
+    /// \brief Batched version. Each row of x is an independent transform.
+    ///
+    /// The batch is the innermost loop, so every twiddle is loaded once per
+    /// butterfly for all rows. Meant for layout_left, where the rows are
+    /// contiguous for a given column, which lets the compiler map one
+    /// transform to one lane. With layout_right every access strides by the
+    /// transform size, c2c_dit2_plan uses the single row kernel instead.
+    template<inout_matrix Mat>
+        requires complex<typename Mat::value_type>
+    auto operator()(Mat x, auto const& twiddles) const noexcept -> void
+    {
+        auto const batch = static_cast<std::size_t>(x.extent(0));
+        auto const size  = static_cast<std::size_t>(x.extent(1));
+        auto const order = bit_log2(size);
+
+        {
+            // stage 0
+            for (auto k{0ULL}; k < size; k += 2) {
+                for (auto b{0ULL}; b < batch; ++b) {
+                    auto const temp = x(b, k) + x(b, k + 1);
+                    x(b, k + 1)     = x(b, k) - x(b, k + 1);
+                    x(b, k)         = temp;
+                }
+            }
+        }
+
+        for (auto stage{1ULL}; stage < order; ++stage) {
+
+            auto const stage_length = ipow<2ULL>(stage);
+            auto const stride       = ipow<2ULL>(stage + 1);
+            auto const tw_stride    = ipow<2ULL>(order - stage - 1ULL);
+
+            for (auto k{0ULL}; k < size; k += stride) {
+                for (auto pair{0ULL}; pair < stage_length; ++pair) {
+                    auto const tw = twiddles[pair * tw_stride];
+
+                    auto const i1 = k + pair;
+                    auto const i2 = k + pair + stage_length;
+
+                    for (auto b{0ULL}; b < batch; ++b) {
+                        auto const odd = tw * x(b, i2);
+                        x(b, i2)       = x(b, i1) - odd;
+                        x(b, i1)       = x(b, i1) + odd;
+                    }
+                }
+            }
+        }
+    }
 };
 
 /// \ingroup neo-fft
@@ -10,6 +10,10 @@
 #include <neo/math/real.hpp>
 #include <neo/type_traits/value_type_t.hpp>
 
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
 namespace neo::fft {
 
 #if defined(NEO_HAS_INTEL_IPP)
@@ -38,6 +42,43 @@ constexpr auto irfft(Plan& plan, InVec input, OutVec output)
     return plan(input, output);
 }
 
+/// \brief Transforms each row of the input matrix into the same row of the output.
+///
+/// Uses the batched interface of the plan, if available. Otherwise one
+/// transform per row is executed. Both matrices may use any layout.
+/// \ingroup neo-fft
+template<typename Plan, in_matrix InMat, out_matrix OutMat>
+    requires(std::floating_point<value_type_t<InMat>> and complex<value_type_t<OutMat>>)
+constexpr auto rfft(Plan& plan, InMat input, OutMat output) -> void
+{
+    assert(std::cmp_equal(input.extent(0), output.extent(0)));
+
+    if constexpr (requires { plan(input, output); }) {
+        plan(input, output);
+    } else {
+        for (auto row{0ULL}; row < static_cast<std::size_t>(input.extent(0)); ++row) {
+            plan(stdex::submdspan(input, row, stdex::full_extent), stdex::submdspan(output, row, stdex::full_extent));
+        }
+    }
+}
+
+/// \brief Inverse transforms each row of the input matrix into the same row of the output.
+/// \ingroup neo-fft
+template<typename Plan, in_matrix InMat, out_matrix OutMat>
+    requires(complex<value_type_t<InMat>> and std::floating_point<value_type_t<OutMat>>)
+constexpr auto irfft(Plan& plan, InMat input, OutMat output) -> void
+{
+    assert(std::cmp_equal(input.extent(0), output.extent(0)));
+
+    if constexpr (requires { plan(input, output); }) {
+        plan(input, output);
+    } else {
+        for (auto row{0ULL}; row < static_cast<std::size_t>(input.extent(0)); ++row) {
+            plan(stdex::submdspan(input, row, stdex::full_extent), stdex::submdspan(output, row, stdex::full_extent));
+        }
+    }
+}
+
 /// \ingroup neo-fft
 template<in_vector InVec, out_vector OutVecX, out_vector OutVecY>
     requires(complex<value_type_t<InVec>> and complex<value_type_t<OutVecX>> and complex<value_type_t<OutVecY>>)
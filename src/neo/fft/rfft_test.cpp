@@ -7,6 +7,7 @@
 #endif
 
 #include <neo/algorithm/allclose.hpp>
+#include <neo/algorithm/copy.hpp>
 #include <neo/algorithm/scale.hpp>
 #include <neo/complex.hpp>
 #include <neo/fft/experimental/rfft.hpp>
@@ -19,6 +20,8 @@
 #include <catch2/generators/catch_generators.hpp>
 
 #include <array>
+#include <cstdint>
+#include <limits>
 #include <random>
 
 namespace {
@@ -77,6 +80,83 @@ TEMPLATE_TEST_CASE("neo/fft: intel_ipp_rfft_plan", "", float, double)
 }
 #endif
 
+TEMPLATE_PRODUCT_TEST_CASE("neo/fft: rfft(batch)", "", (std_complex, neo_complex), (float, double))
+{
+    using Plan    = typename TestType::plan_type;
+    using Float   = typename Plan::real_type;
+    using Complex = typename Plan::complex_type;
+
+    // Pairs of rows share one complex transform, odd counts leave one row unpaired
+    auto const order    = GENERATE(as<std::size_t>{}, 2, 3, 4, 5, 6, 7, 8, 9, 10, 13);
+    auto const num_rows = GENERATE(as<std::size_t>{}, 1, 2, 7, 67);
+    CAPTURE(order);
+    CAPTURE(num_rows);
+
+    using real_matrix    = stdex::mdspan<Float, stdex::dextents<size_t, 2>>;
+    using complex_matrix = stdex::mdspan<Complex, stdex::dextents<size_t, 2>>;
+    STATIC_REQUIRE(requires(Plan p, real_matrix x, complex_matrix z) {
+        p(x, z);
+        p(z, x);
+    });
+
+    auto plan             = Plan{neo::fft::from_order, order};
+    auto const size       = plan.size();
+    auto const num_coeffs = size / 2UL + 1UL;
+
+    auto signal = stdex::mdarray<Float, stdex::dextents<size_t, 2>>{num_rows, size};
+    for (auto row{0UL}; row < num_rows; ++row) {
+        auto const seed  = Catch::getSeed() + static_cast<std::uint32_t>(row);
+        auto const noise = neo::generate_noise_signal<Float>(size, seed);
+        neo::copy(noise.to_mdspan(), stdex::submdspan(signal.to_mdspan(), row, stdex::full_extent));
+    }
+
+    // The paired transforms round differently than the single ones
+    auto const tolerance = std::numeric_limits<Float>::epsilon() * static_cast<Float>(size);
+
+    auto test_batch = [&](auto spectrum, auto output) {
+        neo::fft::rfft(plan, signal.to_mdspan(), spectrum);
+
+        for (auto row{0UL}; row < num_rows; ++row) {
+            auto expected = stdex::mdarray<Complex, stdex::dextents<size_t, 1>>{num_coeffs};
+            neo::fft::rfft(plan, stdex::submdspan(signal.to_mdspan(), row, stdex::full_extent), expected.to_mdspan());
+            auto const actual = stdex::submdspan(spectrum, row, stdex::full_extent);
+            REQUIRE(neo::allclose(expected.to_mdspan(), actual, tolerance));
+        }
+
+        neo::fft::irfft(plan, spectrum, output);
+        neo::scale(Float(1) / static_cast<Float>(size), output);
+        REQUIRE(neo::allclose(signal.to_mdspan(), output));
+
+        // Like a single inverse, the imaginary parts of DC & Nyquist don't leak into the neighbouring row
+        for (auto row{0UL}; row < num_rows; ++row) {
+            spectrum(row, 0)              = Complex{neo::math::real(spectrum(row, 0)), Float(1)};
+            spectrum(row, num_coeffs - 1) = Complex{neo::math::real(spectrum(row, num_coeffs - 1)), Float(-1)};
+        }
+        neo::fft::irfft(plan, spectrum, output);
+        neo::scale(Float(1) / static_cast<Float>(size), output);
+        for (auto row{0UL}; row < num_rows; ++row) {
+            auto expected = stdex::mdarray<Float, stdex::dextents<size_t, 1>>{size};
+            neo::fft::irfft(plan, stdex::submdspan(spectrum, row, stdex::full_extent), expected.to_mdspan());
+            neo::scale(Float(1) / static_cast<Float>(size), expected.to_mdspan());
+            REQUIRE(neo::allclose(expected.to_mdspan(), stdex::submdspan(output, row, stdex::full_extent)));
+        }
+    };
+
+    SECTION("layout_right")
+    {
+        auto spectrum = stdex::mdarray<Complex, stdex::dextents<size_t, 2>, stdex::layout_right>{num_rows, num_coeffs};
+        auto output   = stdex::mdarray<Float, stdex::dextents<size_t, 2>, stdex::layout_right>{num_rows, size};
+        test_batch(spectrum.to_mdspan(), output.to_mdspan());
+    }
+
+    SECTION("layout_left")
+    {
+        auto spectrum = stdex::mdarray<Complex, stdex::dextents<size_t, 2>, stdex::layout_left>{num_rows, num_coeffs};
+        auto output   = stdex::mdarray<Float, stdex::dextents<size_t, 2>, stdex::layout_left>{num_rows, size};
+        test_batch(spectrum.to_mdspan(), output.to_mdspan());
+    }
+}
+
 TEMPLATE_PRODUCT_TEST_CASE("neo/fft: rfft_deinterleave", "", (std::complex, neo::scalar_complex), (float, double))
 {
     using Complex = TestType;
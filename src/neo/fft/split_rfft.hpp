@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/complex/split_complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fft/direction.hpp>
+#include <neo/fft/order.hpp>
+#include <neo/fft/split_fft.hpp>
+#include <neo/fft/twiddle.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace neo::fft {
+
+/// \brief Real FFT with a split-complex spectrum of size()/2+1 bins.
+///
+/// The real signal is packed into a half-size complex signal, which is
+/// transformed by the split-complex plan and then separated into the
+/// spectrum of the even & odd samples. The inverse transform is not
+/// normalized, like irfft.
+///
+/// \ingroup neo-fft
+template<std::floating_point Float, typename SplitPlan = split_fft_plan<Float>>
+struct split_rfft_plan
+{
+    using value_type = Float;
+    using real_type  = Float;
+    using plan_type  = SplitPlan;
+    using size_type  = std::size_t;
+
+    split_rfft_plan(from_order_tag /*tag*/, size_type order);
+
+    [[nodiscard]] auto order() const noexcept -> size_type;
+    [[nodiscard]] auto size() const noexcept -> size_type;
+
+    template<in_vector_of<Float> InVec, out_vector_of<Float> OutVec>
+    auto operator()(InVec in, split_complex<OutVec> out) noexcept -> void;
+
+    template<in_vector_of<Float> InVec, out_vector_of<Float> OutVec>
+    auto operator()(split_complex<InVec> in, OutVec out) noexcept -> void;
+
+    /// Inverse transform of a spectrum that is zero above max_bin, which is not read.
+    template<in_vector_of<Float> InVec, out_vector_of<Float> OutVec>
+    auto operator()(split_complex<InVec> in, OutVec out, size_type max_bin) noexcept -> void;
+
+private:
+    [[nodiscard]] static auto check_order(size_type order) -> size_type;
+    [[nodiscard]] static auto make_twiddles(size_type size);
+
+    size_type _order;
+    SplitPlan _fft{from_order, check_order(_order) - 1U};
+    stdex::mdarray<Float, stdex::dextents<size_type, 2>> _tw{make_twiddles(size())};
+    stdex::mdarray<Float, stdex::dextents<size_type, 2>> _buffer{2, size() / 2U};
+};
+
+template<std::floating_point Float, typename SplitPlan>
+split_rfft_plan<Float, SplitPlan>::split_rfft_plan(from_order_tag /*tag*/, size_type order) : _order{order}
+{}
+
+template<std::floating_point Float, typename SplitPlan>
+auto split_rfft_plan<Float, SplitPlan>::order() const noexcept -> size_type
+{
+    return _order;
+}
+
+template<std::floating_point Float, typename SplitPlan>
+auto split_rfft_plan<Float, SplitPlan>::size() const noexcept -> size_type
+{
+    return fft::size(order());
+}
+
+template<std::floating_point Float, typename SplitPlan>
+template<in_vector_of<Float> InVec, out_vector_of<Float> OutVec>
+auto split_rfft_plan<Float, SplitPlan>::operator()(InVec in, split_complex<OutVec> out) noexcept -> void
+{
+    assert(std::cmp_equal(in.extent(0), size()));
+    assert(std::cmp_equal(out.real.extent(0), size() / 2U + 1U));
+    assert(neo::detail::extents_equal(out.real, out.imag));
+
+    auto const half  = size() / 2U;
+    auto const tw_re = stdex::submdspan(_tw.to_mdspan(), 0, stdex::full_extent);
+    auto const tw_im = stdex::submdspan(_tw.to_mdspan(), 1, stdex::full_extent);
+    auto const z     = split_complex{
+        stdex::submdspan(_buffer.to_mdspan(), 0, stdex::full_extent),
+        stdex::submdspan(_buffer.to_mdspan(), 1, stdex::full_extent),
+    };
+
+    // Even samples go into the real, odd samples into the imaginary part
+    for (auto n = size_type(0); n < half; ++n) {
+        z.real[n] = in[2U * n];
+        z.imag[n] = in[2U * n + 1U];
+    }
+
+    _fft(z, direction::forward);
+
+    out.real[0]    = z.real[0] + z.imag[0];
+    out.imag[0]    = Float(0);
+    out.real[half] = z.real[0] - z.imag[0];
+    out.imag[half] = Float(0);
+
+    for (auto k = size_type(1); k < half; ++k) {
+        auto const ar = z.real[k];
+        auto const ai = z.imag[k];
+        auto const br = z.real[half - k];
+        auto const bi = -z.imag[half - k];
+
+        // even = (a + b) / 2, odd = (a - b) / 2i
+        auto const ere = (ar + br) * Float(0.5);
+        auto const eim = (ai + bi) * Float(0.5);
+        auto const ore = (ai - bi) * Float(0.5);
+        auto const oim = (br - ar) * Float(0.5);
+
+        auto const wre = tw_re[k];
+        auto const wim = tw_im[k];
+
+        out.real[k] = ere + wre * ore - wim * oim;
+        out.imag[k] = eim + wre * oim + wim * ore;
+    }
+}
+
+template<std::floating_point Float, typename SplitPlan>
+template<in_vector_of<Float> InVec, out_vector_of<Float> OutVec>
+auto split_rfft_plan<Float, SplitPlan>::operator()(split_complex<InVec> in, OutVec out) noexcept -> void
+{
+    (*this)(in, out, std::numeric_limits<size_type>::max());
+}
+
+template<std::floating_point Float, typename SplitPlan>
+template<in_vector_of<Float> InVec, out_vector_of<Float> OutVec>
+auto split_rfft_plan<Float, SplitPlan>::operator()(split_complex<InVec> in, OutVec out, size_type max_bin) noexcept
+    -> void
+{
+    assert(std::cmp_equal(in.real.extent(0), size() / 2U + 1U));
+    assert(std::cmp_equal(out.extent(0), size()));
+    assert(neo::detail::extents_equal(in.real, in.imag));
+
+    auto const half  = size() / 2U;
+    auto const last  = std::min(max_bin, half);
+    auto const tw_re = stdex::submdspan(_tw.to_mdspan(), 0, stdex::full_extent);
+    auto const tw_im = stdex::submdspan(_tw.to_mdspan(), 1, stdex::full_extent);
+    auto const z     = split_complex{
+        stdex::submdspan(_buffer.to_mdspan(), 0, stdex::full_extent),
+        stdex::submdspan(_buffer.to_mdspan(), 1, stdex::full_extent),
+    };
+
+    auto const real = [in, last](size_type k) { return k <= last ? static_cast<Float>(in.real[k]) : Float(0); };
+    auto const imag = [in, last](size_type k) { return k <= last ? static_cast<Float>(in.imag[k]) : Float(0); };
+
+    // Inverse of the forward separation, without the 1/2 to match the scale of irfft
+    for (auto k = size_type(0); k < half; ++k) {
+        auto const ar = real(k);
+        auto const ai = imag(k);
+        auto const br = real(half - k);
+        auto const bi = -imag(half - k);
+
+        auto const ere = ar + br;
+        auto const eim = ai + bi;
+        auto const dre = ar - br;
+        auto const dim = ai - bi;
+
+        // odd = (a - b) * conj(w)
+        auto const wre = tw_re[k];
+        auto const wim = tw_im[k];
+        auto const ore = dre * wre + dim * wim;
+        auto const oim = dim * wre - dre * wim;
+
+        z.real[k] = ere - oim;
+        z.imag[k] = eim + ore;
+    }
+
+    _fft(z, direction::backward);
+
+    for (auto n = size_type(0); n < half; ++n) {
+        out[2U * n]      = z.real[n];
+        out[2U * n + 1U] = z.imag[n];
+    }
+}
+
+template<std::floating_point Float, typename SplitPlan>
+auto split_rfft_plan<Float, SplitPlan>::check_order(size_type order) -> size_type
+{
+    // The half-size complex transform needs at least 2 points
+    assert(order >= 2);
+    return order;
+}
+
+template<std::floating_point Float, typename SplitPlan>
+auto split_rfft_plan<Float, SplitPlan>::make_twiddles(size_type size)
+{
+    auto const interleaved = make_twiddle_lut_radix2<std::complex<Float>>(size, direction::forward);
+
+    auto tw = stdex::mdarray<Float, stdex::dextents<size_type, 2>>{2, interleaved.extent(0)};
+    for (auto k = size_type(0); k < interleaved.extent(0); ++k) {
+        tw(0, k) = interleaved(k).real();
+        tw(1, k) = interleaved(k).imag();
+    }
+    return tw;
+}
+
+/// \ingroup neo-fft
+template<typename Plan, in_vector InVec, out_vector OutVec>
+    requires(std::floating_point<value_type_t<InVec>> and std::floating_point<value_type_t<OutVec>>)
+constexpr auto rfft(Plan& plan, InVec input, split_complex<OutVec> output) -> void
+{
+    plan(input, output);
+}
+
+/// \ingroup neo-fft
+template<typename Plan, in_vector InVec, out_vector OutVec>
+    requires(std::floating_point<value_type_t<InVec>> and std::floating_point<value_type_t<OutVec>>)
+constexpr auto irfft(Plan& plan, split_complex<InVec> input, OutVec output) -> void
+{
+    plan(input, output);
+}
+
+}  // namespace neo::fft
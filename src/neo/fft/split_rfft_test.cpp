@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+
+#include "split_rfft.hpp"
+
+#include <neo/algorithm/allclose.hpp>
+#include <neo/algorithm/scale.hpp>
+#include <neo/fft/rfft.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <complex>
+
+TEMPLATE_TEST_CASE("neo/fft: split_rfft_plan", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const order = GENERATE(as<std::size_t>{}, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14);
+    CAPTURE(order);
+
+    auto plan = neo::fft::split_rfft_plan<Float>{neo::fft::from_order, order};
+    REQUIRE(plan.order() == order);
+    REQUIRE(plan.size() == neo::fft::size(order));
+
+    auto const size   = plan.size();
+    auto const bins   = size / 2 + 1;
+    auto const signal = neo::generate_noise_signal<Float>(size, Catch::getSeed());
+
+    auto buf      = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{2, bins};
+    auto spectrum = neo::split_complex{
+        stdex::submdspan(buf.to_mdspan(), 0, stdex::full_extent),
+        stdex::submdspan(buf.to_mdspan(), 1, stdex::full_extent),
+    };
+
+    auto reference_plan = neo::fft::rfft_plan<Float>{neo::fft::from_order, order};
+    auto reference      = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{bins};
+    neo::fft::rfft(reference_plan, signal.to_mdspan(), reference.to_mdspan());
+
+    SECTION("forward")
+    {
+        neo::fft::rfft(plan, signal.to_mdspan(), spectrum);
+
+        auto const tolerance = static_cast<double>(size) * 1e-5;
+        for (auto k = std::size_t(0); k < bins; ++k) {
+            CAPTURE(k);
+            REQUIRE(spectrum.real[k] == Catch::Approx(reference(k).real()).margin(tolerance));
+            REQUIRE(spectrum.imag[k] == Catch::Approx(reference(k).imag()).margin(tolerance));
+        }
+    }
+
+    SECTION("roundtrip")
+    {
+        auto output = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+        neo::fft::rfft(plan, signal.to_mdspan(), spectrum);
+        neo::fft::irfft(plan, spectrum, output.to_mdspan());
+
+        neo::scale(Float(1) / static_cast<Float>(size), output.to_mdspan());
+        REQUIRE(neo::allclose(signal.to_mdspan(), output.to_mdspan()));
+    }
+
+    SECTION("pruned inverse")
+    {
+        auto const max_bin = bins / 3;
+        neo::fft::rfft(plan, signal.to_mdspan(), spectrum);
+
+        // Garbage above max_bin must not be read
+        auto full = buf;
+        for (auto k = max_bin + 1; k < bins; ++k) {
+            spectrum.real[k] = Float(1e6);
+            spectrum.imag[k] = Float(-1e6);
+            full(0, k)       = Float(0);
+            full(1, k)       = Float(0);
+        }
+
+        auto expected = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+        auto output   = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{size};
+        plan(
+            neo::split_complex{
+                stdex::submdspan(full.to_mdspan(), 0, stdex::full_extent),
+                stdex::submdspan(full.to_mdspan(), 1, stdex::full_extent),
+            },
+            expected.to_mdspan()
+        );
+        plan(spectrum, output.to_mdspan(), max_bin);
+
+        REQUIRE(neo::allclose(expected.to_mdspan(), output.to_mdspan(), Float(1e-3)));
+    }
+}
@@ -2,17 +2,20 @@
 
 #pragma once
 
-#include <neo/algorithm/copy.hpp>
-#include <neo/algorithm/fill.hpp>
-#include <neo/algorithm/multiply.hpp>
-#include <neo/algorithm/scale.hpp>
 #include <neo/complex/complex.hpp>
 #include <neo/container/mdspan.hpp>
+#include <neo/execution/thread_pool.hpp>
 #include <neo/fft/rfft.hpp>
 #include <neo/math/idiv.hpp>
 #include <neo/math/windowing.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace neo::fft {
 
@@ -24,6 +27,26 @@ num_sftf_frames(std::size_t signal_size, std::size_t frame_size, std::size_t ove
     return idiv(signal_size - frame_size + overlap_size, frame_size - overlap_size) + 1;
 }
 
+/// out = in * window, zero padded to the size of out. One pass over out.
+template<in_vector InVec, in_vector Window, out_vector OutVec>
+constexpr auto window_and_pad(InVec in, Window window, OutVec out) noexcept -> void
+{
+    using Float = value_type_t<OutVec>;
+
+    assert(in.extent(0) <= out.extent(0));
+    assert(in.extent(0) <= window.extent(0));
+
+    auto const num_samples = static_cast<std::size_t>(in.extent(0));
+    auto const size        = static_cast<std::size_t>(out.extent(0));
+
+    for (auto i = std::size_t(0); i < num_samples; ++i) {
+        out[i] = static_cast<Float>(in[i]) * static_cast<Float>(window[i]);
+    }
+    for (auto i = num_samples; i < size; ++i) {
+        out[i] = Float(0);
+    }
+}
+
 }  // namespace detail
 
 /// \ingroup neo-fft
@@ -36,6 +59,13 @@ struct stft_options
     std::function<Float(std::size_t, std::size_t)> window{hann_window<Float>{}};
 };
 
+/// \brief Short-time fourier transform.
+///
+/// Frames are windowed & zero padded straight into a small batch buffer, which
+/// is transformed into the result with the batched rfft. With a thread_pool the
+/// (channel, batch) jobs are split across the threads, each with its own
+/// rfft plan and buffer.
+///
 /// \ingroup neo-fft
 template<std::floating_point Float, complex Complex = std::complex<Float>>
 struct stft_plan
@@ -51,61 +81,115 @@ struct stft_plan
     explicit stft_plan(stft_options<Float> options) : _options{std::move(options)}
     {
         fill_window(_window.to_mdspan(), _options.window);
+        _workers.push_back(std::make_unique<worker>(_order));
     }
 
+    stft_plan(stft_options<Float> options, thread_pool& pool) : stft_plan{std::move(options)}
+    {
+        _pool = &pool;
+        while (_workers.size() < pool.num_threads()) {
+            _workers.push_back(std::make_unique<worker>(_order));
+        }
+    }
+
+    [[nodiscard]] auto num_frames(std::size_t signal_size) const noexcept -> std::size_t
+    {
+        return detail::num_sftf_frames(signal_size, _options.frame_size, _options.overlap_size);
+    }
+
+    [[nodiscard]] auto num_bins() const noexcept -> std::size_t { return fft::size(_order) / 2UL + 1UL; }
+
     template<in_matrix InMat>
         requires std::convertible_to<value_type_t<InMat>, Float>
     [[nodiscard]] auto operator()(InMat x)
     {
-        auto const frame_len = _options.frame_size;
-        auto const overlap   = _options.overlap_size;
+        auto result = stdex::mdarray<Complex, stdex::dextents<std::size_t, 3>>{
+            static_cast<std::size_t>(x.extent(0)),
+            num_frames(static_cast<std::size_t>(x.extent(1))),
+            num_bins(),
+        };
 
-        auto const num_channels = static_cast<std::size_t>(x.extent(0));
-        auto const signal_len   = static_cast<std::size_t>(x.extent(1));
+        (*this)(x, result.to_mdspan());
+        return result;
+    }
 
-        auto const num_bins   = _rfft.size() / 2UL + 1UL;
-        auto const num_frames = detail::num_sftf_frames(signal_len, frame_len, overlap);
+    /// Writes into an existing channels x frames x bins tensor.
+    template<in_matrix InMat, typename OutTensor>
+        requires(std::convertible_to<value_type_t<InMat>, Float> and is_mdspan<OutTensor> and OutTensor::rank() == 3)
+    auto operator()(InMat x, OutTensor out) -> void
+    {
+        auto const num_channels = static_cast<std::size_t>(x.extent(0));
+        auto const frames       = num_frames(static_cast<std::size_t>(x.extent(1)));
+        auto const batches      = idiv(frames, batch_size);
+        auto const num_jobs     = num_channels * batches;
+
+        assert(std::cmp_equal(out.extent(0), num_channels));
+        assert(std::cmp_equal(out.extent(1), frames));
+        assert(std::cmp_equal(out.extent(2), num_bins()));
+
+        auto const run = [this, x, out, frames, batches](worker& w, std::size_t first_job, std::size_t last_job) {
+            for (auto job = first_job; job < last_job; ++job) {
+                auto const ch    = job / batches;
+                auto const first = (job % batches) * batch_size;
+                auto const count = std::min(batch_size, frames - first);
+                transform_batch(w, x, out, ch, first, count);
+            }
+        };
 
-        auto const in  = _input.to_mdspan();
-        auto const out = _output.to_mdspan();
+        if (_pool == nullptr or num_jobs <= 1) {
+            run(*_workers[0], 0, num_jobs);
+            return;
+        }
 
-        auto result = stdex::mdarray<Complex, stdex::dextents<std::size_t, 3>>{
-            num_channels,
-            num_frames,
-            num_bins,
-        };
+        auto const chunks = std::min(_workers.size(), num_jobs);
+        _pool->parallel_for(chunks, [this, &run, chunks, num_jobs](std::size_t chunk) {
+            run(*_workers[chunk], num_jobs * chunk / chunks, num_jobs * (chunk + 1) / chunks);
+        });
+    }
 
-        for (auto ch_idx = std::size_t(0); ch_idx < num_channels; ++ch_idx) {
-            for (auto frame_idx = std::size_t(0); frame_idx < num_frames; ++frame_idx) {
-                auto const sample_idx  = frame_idx * frame_len - frame_idx * overlap;
-                auto const num_samples = std::min(signal_len - sample_idx, frame_len);
+private:
+    /// Number of frames handed to the batched rfft at once.
+    static constexpr auto const batch_size = std::size_t(16);
 
-                auto const in_block  = stdex::submdspan(x, ch_idx, std::tuple{sample_idx, sample_idx + num_samples});
-                auto const in_window = stdex::submdspan(in, std::tuple{0, num_samples});
-                fill(in, Float(0));
-                fill(out, Float(0));
-                copy(in_block, in_window);
+    struct worker
+    {
+        explicit worker(std::size_t order) : rfft{from_order, order} {}
 
-                multiply(in, _window.to_mdspan(), in);
-                _rfft(in, out);
+        rfft_plan<Float, Complex> rfft;
+        stdex::mdarray<Float, stdex::dextents<std::size_t, 2>> frames{batch_size, rfft.size()};
+    };
 
-                auto coeffs       = stdex::submdspan(out, std::tuple{0, num_bins});
-                auto result_frame = stdex::submdspan(result.to_mdspan(), ch_idx, frame_idx, std::tuple{0, num_bins});
-                copy(coeffs, result_frame);
-            }
+    template<typename InMat, typename OutTensor>
+    auto transform_batch(worker& w, InMat x, OutTensor out, std::size_t ch, std::size_t first, std::size_t count)
+        -> void
+    {
+        auto const frame_len  = _options.frame_size;
+        auto const overlap    = _options.overlap_size;
+        auto const signal_len = static_cast<std::size_t>(x.extent(1));
+
+        auto const frames = stdex::submdspan(w.frames.to_mdspan(), std::tuple{0, count}, stdex::full_extent);
+        for (auto i = std::size_t(0); i < count; ++i) {
+            auto const frame_idx   = first + i;
+            auto const sample_idx  = frame_idx * frame_len - frame_idx * overlap;
+            auto const num_samples = std::min(signal_len - sample_idx, frame_len);
+
+            detail::window_and_pad(
+                stdex::submdspan(x, ch, std::tuple{sample_idx, sample_idx + num_samples}),
+                _window.to_mdspan(),
+                stdex::submdspan(frames, i, stdex::full_extent)
+            );
         }
 
-        return result;
+        auto const coeffs = stdex::submdspan(out, ch, std::tuple{first, first + count}, stdex::full_extent);
+        rfft(w.rfft, frames, coeffs);
     }
 
-private:
     stft_options<Float> _options;
+    std::size_t _order{next_order(_options.transform_size)};
+    stdex::mdarray<Float, stdex::dextents<std::size_t, 1>> _window{fft::size(_order)};
 
-    rfft_plan<Float> _rfft{from_order, next_order(_options.transform_size)};
-    stdex::mdarray<Float, stdex::dextents<std::size_t, 1>> _input{_rfft.size()};
-    stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>> _output{_rfft.size()};
-
-    stdex::mdarray<Float, stdex::dextents<std::size_t, 1>> _window{_rfft.size()};
+    thread_pool* _pool{nullptr};
+    std::vector<std::unique_ptr<worker>> _workers;
 };
 
 /// \ingroup neo-fft
@@ -116,6 +200,14 @@ template<in_matrix InMat>
     return plan(x);
 }
 
+/// \ingroup neo-fft
+template<in_matrix InMat>
+[[nodiscard]] auto stft(InMat x, stft_options<typename InMat::value_type> options, thread_pool& pool)
+{
+    auto plan = stft_plan<typename InMat::value_type>{options, pool};
+    return plan(x);
+}
+
 /// \ingroup neo-fft
 template<in_matrix InMat>
 [[nodiscard]] auto stft(InMat x, std::size_t window_size)
@@ -0,0 +1,309 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/algorithm/fill.hpp>
+#include <neo/complex/complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fft/order.hpp>
+#include <neo/fft/rfft.hpp>
+#include <neo/math/windowing.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace neo::fft {
+
+namespace detail {
+
+/// \brief Sliding input frames of a streaming STFT.
+///
+/// Buffers blocks of any size. Every hop_size() samples on_hop(frames) gets the
+/// last frame_size() samples of each channel as a num_channels() x frame_size()
+/// matrix, afterwards the frames slide by one hop.
+template<std::floating_point Float>
+struct stft_frames
+{
+    using size_type = std::size_t;
+
+    stft_frames(size_type order, size_type num_channels, size_type hop_divisor);
+
+    [[nodiscard]] auto frame_size() const noexcept -> size_type;
+    [[nodiscard]] auto hop_size() const noexcept -> size_type;
+    [[nodiscard]] auto num_channels() const noexcept -> size_type;
+
+    auto reset() noexcept -> void;
+
+    /// exchange(first, position, slots) fills the channels x count slots with
+    /// the samples starting at first, position is the offset inside the hop.
+    template<typename Exchange, typename OnHop>
+    auto operator()(size_type num_samples, Exchange exchange, OnHop on_hop) -> void;
+
+private:
+    [[nodiscard]] static auto check_hop_divisor(size_type order, size_type hop_divisor) -> size_type;
+
+    size_type _hop_size;
+    size_type _position{0};
+    stdex::mdarray<Float, stdex::dextents<size_type, 2>> _frames;
+};
+
+template<std::floating_point Float>
+stft_frames<Float>::stft_frames(size_type order, size_type num_channels, size_type hop_divisor)
+    : _hop_size{check_hop_divisor(order, hop_divisor)}
+    , _frames{num_channels, fft::size(order)}
+{}
+
+template<std::floating_point Float>
+auto stft_frames<Float>::frame_size() const noexcept -> size_type
+{
+    return static_cast<size_type>(_frames.extent(1));
+}
+
+template<std::floating_point Float>
+auto stft_frames<Float>::hop_size() const noexcept -> size_type
+{
+    return _hop_size;
+}
+
+template<std::floating_point Float>
+auto stft_frames<Float>::num_channels() const noexcept -> size_type
+{
+    return static_cast<size_type>(_frames.extent(0));
+}
+
+template<std::floating_point Float>
+auto stft_frames<Float>::reset() noexcept -> void
+{
+    fill(_frames.to_mdspan(), Float(0));
+    _position = 0;
+}
+
+template<std::floating_point Float>
+template<typename Exchange, typename OnHop>
+auto stft_frames<Float>::operator()(size_type num_samples, Exchange exchange, OnHop on_hop) -> void
+{
+    auto const size   = frame_size();
+    auto const frames = _frames.to_mdspan();
+
+    for (auto first = size_type(0); first < num_samples;) {
+        auto const count  = std::min(_hop_size - _position, num_samples - first);
+        auto const offset = size - _hop_size + _position;
+
+        // New samples go into the tail of the frames
+        exchange(first, _position, stdex::submdspan(frames, stdex::full_extent, std::tuple{offset, offset + count}));
+
+        first += count;
+        _position += count;
+
+        if (_position == _hop_size) {
+            on_hop(stdex::mdspan<Float const, stdex::dextents<size_type, 2>>{frames});
+
+            for (auto ch = size_type(0); ch < num_channels(); ++ch) {
+                for (auto i = size_type(0); i < size - _hop_size; ++i) {
+                    frames(ch, i) = frames(ch, i + _hop_size);
+                }
+            }
+            _position = 0;
+        }
+    }
+}
+
+template<std::floating_point Float>
+auto stft_frames<Float>::check_hop_divisor(size_type order, size_type hop_divisor) -> size_type
+{
+    auto const size = fft::size(order);
+    if (hop_divisor == 0 or hop_divisor > size or size % hop_divisor != 0) {
+        throw std::runtime_error{"stft: hop divisor must divide the frame size"};
+    }
+    return size / hop_divisor;
+}
+
+}  // namespace detail
+
+/// \brief Streaming STFT with weighted overlap-add resynthesis.
+///
+/// Accepts blocks of any size. Every hop_size() samples the last frame_size()
+/// samples of each channel are windowed and transformed, the callback gets the
+/// spectra as a num_channels() x num_bins() matrix, and the (modified) spectra
+/// are transformed back and overlap-added. The synthesis window is normalized
+/// so that an identity callback reconstructs the input, delayed by latency()
+/// samples. All buffers are allocated in the constructor, processing never
+/// allocates.
+///
+/// \ingroup neo-fft
+template<std::floating_point Float, complex Complex = std::complex<Float>>
+struct stft_processor
+{
+    using real_type    = Float;
+    using complex_type = Complex;
+    using size_type    = std::size_t;
+
+    template<typename Window = hann_window<Float>>
+    stft_processor(
+        from_order_tag /*tag*/,
+        size_type order,
+        size_type num_channels,
+        size_type hop_divisor = 2,
+        Window window         = Window{}
+    );
+
+    [[nodiscard]] auto frame_size() const noexcept -> size_type;
+    [[nodiscard]] auto hop_size() const noexcept -> size_type;
+    [[nodiscard]] auto num_channels() const noexcept -> size_type;
+    [[nodiscard]] auto num_bins() const noexcept -> size_type;
+    [[nodiscard]] auto latency() const noexcept -> size_type;
+
+    auto reset() noexcept -> void;
+
+    /// Processes the channels x samples block in-place. callback(inout_matrix) is called once per hop.
+    template<inout_matrix Mat, typename Callback>
+    auto operator()(Mat block, Callback callback) -> void;
+
+private:
+    template<in_matrix Frames, typename Callback>
+    auto process_frame(Frames frames, Callback& callback) -> void;
+
+    rfft_plan<Float, Complex> _rfft;
+    detail::stft_frames<Float> _frames;
+    size_type _num_channels;
+
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _analysis{_rfft.size()};
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _synthesis{_rfft.size()};
+    stdex::mdarray<Float, stdex::dextents<size_type, 1>> _frame{_rfft.size()};
+    stdex::mdarray<Float, stdex::dextents<size_type, 2>> _output{_num_channels, _rfft.size()};
+    stdex::mdarray<Complex, stdex::dextents<size_type, 2>> _spectrum{_num_channels, _rfft.size() / 2 + 1};
+};
+
+template<std::floating_point Float, complex Complex>
+template<typename Window>
+stft_processor<Float, Complex>::stft_processor(
+    from_order_tag /*tag*/,
+    size_type order,
+    size_type num_channels,
+    size_type hop_divisor,
+    Window window
+)
+    : _rfft{from_order, order}
+    , _frames{order, num_channels, hop_divisor}
+    , _num_channels{num_channels}
+{
+    auto const size = frame_size();
+    auto const hop  = hop_size();
+    fill_window(_analysis.to_mdspan(), window);
+
+    // Every output sample is the sum of frame_size / hop_size windowed frames. Dividing by the sum of the
+    // squared windows at each position of the hop makes the analysis * synthesis window add up to one.
+    // The 1/N of the inverse transform is folded in as well.
+    for (auto i = size_type(0); i < hop; ++i) {
+        auto norm = Float(0);
+        for (auto j = i; j < size; j += hop) {
+            norm += _analysis(j) * _analysis(j);
+        }
+
+        auto const scale = norm > Float(0) ? Float(1) / (norm * static_cast<Float>(size)) : Float(0);
+        for (auto j = i; j < size; j += hop) {
+            _synthesis(j) = _analysis(j) * scale;
+        }
+    }
+
+    reset();
+}
+
+template<std::floating_point Float, complex Complex>
+auto stft_processor<Float, Complex>::frame_size() const noexcept -> size_type
+{
+    return _rfft.size();
+}
+
+template<std::floating_point Float, complex Complex>
+auto stft_processor<Float, Complex>::hop_size() const noexcept -> size_type
+{
+    return _frames.hop_size();
+}
+
+template<std::floating_point Float, complex Complex>
+auto stft_processor<Float, Complex>::num_channels() const noexcept -> size_type
+{
+    return _num_channels;
+}
+
+template<std::floating_point Float, complex Complex>
+auto stft_processor<Float, Complex>::num_bins() const noexcept -> size_type
+{
+    return frame_size() / 2 + 1;
+}
+
+template<std::floating_point Float, complex Complex>
+auto stft_processor<Float, Complex>::latency() const noexcept -> size_type
+{
+    return frame_size();
+}
+
+template<std::floating_point Float, complex Complex>
+auto stft_processor<Float, Complex>::reset() noexcept -> void
+{
+    _frames.reset();
+    fill(_output.to_mdspan(), Float(0));
+}
+
+template<std::floating_point Float, complex Complex>
+template<inout_matrix Mat, typename Callback>
+auto stft_processor<Float, Complex>::operator()(Mat block, Callback callback) -> void
+{
+    assert(std::cmp_equal(block.extent(0), _num_channels));
+
+    auto const num_samples = static_cast<size_type>(block.extent(1));
+    auto const output      = _output.to_mdspan();
+
+    // Samples completed by the last frame go out, new samples go into the input frames
+    auto exchange = [block, output](size_type first, size_type position, auto slots) {
+        for (auto ch = size_type(0); ch < slots.extent(0); ++ch) {
+            for (auto i = size_type(0); i < slots.extent(1); ++i) {
+                slots(ch, i)         = static_cast<Float>(block(ch, first + i));
+                block(ch, first + i) = output(ch, position + i);
+            }
+        }
+    };
+
+    _frames(num_samples, exchange, [this, &callback](auto frames) { process_frame(frames, callback); });
+}
+
+template<std::floating_point Float, complex Complex>
+template<in_matrix Frames, typename Callback>
+auto stft_processor<Float, Complex>::process_frame(Frames frames, Callback& callback) -> void
+{
+    auto const size      = frame_size();
+    auto const hop       = hop_size();
+    auto const output    = _output.to_mdspan();
+    auto const frame     = _frame.to_mdspan();
+    auto const spectrum  = _spectrum.to_mdspan();
+    auto const analysis  = _analysis.to_mdspan();
+    auto const synthesis = _synthesis.to_mdspan();
+
+    for (auto ch = size_type(0); ch < _num_channels; ++ch) {
+        for (auto i = size_type(0); i < size; ++i) {
+            frame[i] = frames(ch, i) * analysis[i];
+        }
+        rfft(_rfft, frame, stdex::submdspan(spectrum, ch, stdex::full_extent));
+    }
+
+    callback(spectrum);
+
+    for (auto ch = size_type(0); ch < _num_channels; ++ch) {
+        irfft(_rfft, stdex::submdspan(spectrum, ch, stdex::full_extent), frame);
+
+        // Drop the hop that was just sent out, then add the new frame
+        for (auto i = size_type(0); i < size - hop; ++i) {
+            output(ch, i) = output(ch, i + hop) + frame[i] * synthesis[i];
+        }
+        for (auto i = size - hop; i < size; ++i) {
+            output(ch, i) = frame[i] * synthesis[i];
+        }
+    }
+}
+
+}  // namespace neo::fft
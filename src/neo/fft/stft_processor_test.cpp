@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+
+#include "stft_processor.hpp"
+
+#include <neo/algorithm/allclose.hpp>
+#include <neo/algorithm/copy.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+
+namespace {
+
+template<typename Processor, typename Callback>
+auto process_in_blocks(Processor& proc, neo::inout_matrix auto signal, std::size_t block_size, Callback callback)
+{
+    auto const num_samples = static_cast<std::size_t>(signal.extent(1));
+    for (auto first = std::size_t(0); first < num_samples; first += block_size) {
+        auto const last  = std::min(first + block_size, num_samples);
+        auto const block = stdex::submdspan(signal, stdex::full_extent, std::tuple{first, last});
+        proc(block, callback);
+    }
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("neo/fft: stft_processor", "", float, double)
+{
+    using Float = TestType;
+
+    auto const order        = GENERATE(as<std::size_t>{}, 5, 8);
+    auto const hop_divisor  = GENERATE(as<std::size_t>{}, 2, 4, 8);
+    auto const block_size   = GENERATE(as<std::size_t>{}, 1, 7, 64, 500);
+    auto const num_channels = GENERATE(as<std::size_t>{}, 1, 2);
+    CAPTURE(order);
+    CAPTURE(hop_divisor);
+    CAPTURE(block_size);
+    CAPTURE(num_channels);
+
+    auto proc = neo::fft::stft_processor<Float>{neo::fft::from_order, order, num_channels, hop_divisor};
+    REQUIRE(proc.frame_size() == neo::fft::size(order));
+    REQUIRE(proc.hop_size() == proc.frame_size() / hop_divisor);
+    REQUIRE(proc.num_channels() == num_channels);
+    REQUIRE(proc.num_bins() == proc.frame_size() / 2 + 1);
+    REQUIRE(proc.latency() == proc.frame_size());
+
+    auto const num_samples = std::size_t(2000);
+    auto input             = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_channels, num_samples};
+    for (auto ch = std::size_t(0); ch < num_channels; ++ch) {
+        auto const noise = neo::generate_noise_signal<Float>(num_samples, Catch::getSeed() + ch);
+        neo::copy(noise.to_mdspan(), stdex::submdspan(input.to_mdspan(), ch, stdex::full_extent));
+    }
+
+    auto num_calls = std::size_t(0);
+    auto output    = input;
+    process_in_blocks(proc, output.to_mdspan(), block_size, [&num_calls, &proc](neo::inout_matrix auto spectrum) {
+        REQUIRE(spectrum.extent(0) == proc.num_channels());
+        REQUIRE(spectrum.extent(1) == proc.num_bins());
+        ++num_calls;
+    });
+    REQUIRE(num_calls == num_samples / proc.hop_size());
+
+    // Identity callback reconstructs the input, delayed by the latency
+    auto const latency = proc.latency();
+    auto const delayed = stdex::submdspan(output.to_mdspan(), stdex::full_extent, std::tuple{latency, num_samples});
+    auto const source  = stdex::submdspan(input.to_mdspan(), stdex::full_extent, std::tuple{0, num_samples - latency});
+
+    auto const zeros   = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_channels, num_samples};
+    auto const silence = stdex::submdspan(output.to_mdspan(), stdex::full_extent, std::tuple{0, latency});
+    REQUIRE(neo::allclose(delayed, source, Float(1e-4)));
+    REQUIRE(neo::allclose(
+        silence,
+        stdex::submdspan(zeros.to_mdspan(), stdex::full_extent, std::tuple{0, latency}),
+        Float(1e-4)
+    ));
+
+    // Zeroed spectrum produces silence
+    proc.reset();
+    auto muted = input;
+    process_in_blocks(proc, muted.to_mdspan(), block_size, [](neo::inout_matrix auto spectrum) {
+        for (auto ch = std::size_t(0); ch < spectrum.extent(0); ++ch) {
+            for (auto bin = std::size_t(0); bin < spectrum.extent(1); ++bin) {
+                spectrum(ch, bin) = {};
+            }
+        }
+    });
+    REQUIRE(neo::allclose(muted.to_mdspan(), zeros.to_mdspan(), Float(0)));
+}
+
+TEMPLATE_TEST_CASE("neo/fft: stft_processor(window)", "", float, double)
+{
+    using Float = TestType;
+
+    auto proc = neo::fft::stft_processor<Float>{
+        neo::fft::from_order,
+        7,
+        1,
+        4,
+        neo::hamming_window<Float>{},
+    };
+
+    auto signal = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{1, 1024};
+    auto noise  = neo::generate_noise_signal<Float>(1024, Catch::getSeed());
+    neo::copy(noise.to_mdspan(), stdex::submdspan(signal.to_mdspan(), 0, stdex::full_extent));
+
+    auto output = signal;
+    proc(output.to_mdspan(), [](auto) {});
+
+    auto const latency = proc.latency();
+    REQUIRE(neo::allclose(
+        stdex::submdspan(output.to_mdspan(), stdex::full_extent, std::tuple{latency, 1024}),
+        stdex::submdspan(signal.to_mdspan(), stdex::full_extent, std::tuple{0, 1024 - latency}),
+        Float(1e-4)
+    ));
+
+    REQUIRE_THROWS(neo::fft::stft_processor<Float>{neo::fft::from_order, 7, 1, 0});
+    REQUIRE_THROWS(neo::fft::stft_processor<Float>{neo::fft::from_order, 7, 1, 3});
+    REQUIRE_THROWS(neo::fft::stft_processor<Float>{neo::fft::from_order, 7, 1, 256});
+}
@@ -2,9 +2,18 @@
 
 #include "stft.hpp"
 
+#include <neo/algorithm/allclose.hpp>
+#include <neo/algorithm/copy.hpp>
+#include <neo/algorithm/fill.hpp>
+#include <neo/testing/testing.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 
+#include <algorithm>
+#include <complex>
+
 TEST_CASE("neo/fft: detail::num_sftf_frames")
 {
     REQUIRE(neo::fft::detail::num_sftf_frames(1024, 128, 0) == 8);
@@ -35,3 +44,63 @@ TEMPLATE_TEST_CASE("neo/fft: stft", "", float, double)
     REQUIRE(half_overlap.extent(1) == 16);
     REQUIRE(half_overlap.extent(2) == 129);
 }
+
+TEMPLATE_TEST_CASE("neo/fft: stft(thread_pool)", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = std::complex<Float>;
+
+    auto const num_channels  = GENERATE(as<std::size_t>{}, 1, 3);
+    auto const signal_length = GENERATE(as<std::size_t>{}, 500, 4096, 10000);
+    auto const num_threads   = GENERATE(as<std::size_t>{}, 1, 2, 3);
+    CAPTURE(num_channels);
+    CAPTURE(signal_length);
+    CAPTURE(num_threads);
+
+    auto signal = stdex::mdarray<Float, stdex::dextents<std::size_t, 2>>{num_channels, signal_length};
+    for (auto ch = std::size_t(0); ch < num_channels; ++ch) {
+        auto const noise = neo::generate_noise_signal<Float>(signal_length, Catch::getSeed() + ch);
+        neo::copy(noise.to_mdspan(), stdex::submdspan(signal.to_mdspan(), ch, stdex::full_extent));
+    }
+
+    auto const options = neo::fft::stft_options<Float>{
+        .frame_size     = 200,
+        .transform_size = 256,
+        .overlap_size   = 50,
+    };
+
+    auto pool   = neo::thread_pool{num_threads};
+    auto result = neo::fft::stft(signal.to_mdspan(), options, pool);
+    REQUIRE(result.extent(0) == num_channels);
+    REQUIRE(result.extent(1) == neo::fft::detail::num_sftf_frames(signal_length, 200, 50));
+    REQUIRE(result.extent(2) == 129);
+
+    auto serial = neo::fft::stft(signal.to_mdspan(), options);
+    REQUIRE(neo::allclose(
+        stdex::mdspan{serial.data(), serial.size()},
+        stdex::mdspan{result.data(), result.size()},
+        Float(0)
+    ));
+
+    // Reference: window, pad & transform every frame on its own
+    auto rfft   = neo::fft::rfft_plan<Float, Complex>{neo::fft::from_order, 8};
+    auto window = neo::generate_window<Float>(256);
+    auto frame  = stdex::mdarray<Float, stdex::dextents<std::size_t, 1>>{256};
+    auto coeffs = stdex::mdarray<Complex, stdex::dextents<std::size_t, 1>>{129};
+
+    for (auto ch = std::size_t(0); ch < num_channels; ++ch) {
+        for (auto f = std::size_t(0); f < result.extent(1); ++f) {
+            auto const start = f * 150;
+            auto const count = std::min(signal_length - start, std::size_t(200));
+
+            neo::fill(frame.to_mdspan(), Float(0));
+            for (auto i = std::size_t(0); i < count; ++i) {
+                frame(i) = signal(ch, start + i) * window(i);
+            }
+            neo::fft::rfft(rfft, frame.to_mdspan(), coeffs.to_mdspan());
+
+            auto const actual = stdex::submdspan(result.to_mdspan(), ch, f, stdex::full_extent);
+            REQUIRE(neo::allclose(coeffs.to_mdspan(), actual, Float(1e-4)));
+        }
+    }
+}
@@ -4,5 +4,6 @@
 
 #include <neo/fixed_point/algorithm.hpp>
 #include <neo/fixed_point/complex.hpp>
+#include <neo/fixed_point/complex_multiply.hpp>
 #include <neo/fixed_point/fixed_point.hpp>
 #include <neo/fixed_point/simd.hpp>
@@ -77,6 +77,7 @@ private:
 
 using complex_q7  = fixed_point_complex<q7>;
 using complex_q15 = fixed_point_complex<q15>;
+using complex_q31 = fixed_point_complex<q31>;
 
 template<typename FixedPoint>
 inline constexpr auto const is_complex<fixed_point_complex<FixedPoint>> = true;
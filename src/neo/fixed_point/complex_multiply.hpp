@@ -0,0 +1,719 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/complex/split_complex.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/fixed_point/complex.hpp>
+#include <neo/fixed_point/fixed_point.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#if defined(NEO_HAS_ISA_SSE41)
+    #include <immintrin.h>
+#endif
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace neo {
+
+namespace detail {
+
+template<typename T>
+concept q15_or_q31 = std::same_as<T, q15> or std::same_as<T, q31>;
+
+template<typename T>
+concept complex_q15_or_q31 = std::same_as<T, complex_q15> or std::same_as<T, complex_q31>;
+
+/// \brief Rounded & saturated x * y + z of one bin, the SIMD kernels match it bit for bit.
+///
+/// The sums of products are exact. The only one that does not fit into 64 bits
+/// is the imaginary part of (-1 - 1i) * (-1 - 1i) in q31, it saturates.
+template<q15_or_q31 FixedPoint>
+struct fixed_point_complex_math
+{
+    using int_type = typename FixedPoint::storage_type;
+
+    static constexpr auto const bits  = FixedPoint::fractional_bits;
+    static constexpr auto const round = std::int64_t(1) << (bits - 1);
+
+    [[nodiscard]] static constexpr auto narrow(std::int64_t sum) noexcept -> int_type
+    {
+        return saturate<int_type>((sum + round) >> bits);
+    }
+
+    [[nodiscard]] static constexpr auto add(int_type lhs, int_type rhs) noexcept -> int_type
+    {
+        return saturate<int_type>(std::int64_t(lhs) + std::int64_t(rhs));
+    }
+
+    [[nodiscard]] static constexpr auto sum_products(std::int64_t a, std::int64_t b) noexcept -> std::int64_t
+    {
+        auto const half = std::int64_t(1) << 62;
+        return (a == half and b == half) ? half : a + b;
+    }
+
+    static constexpr auto
+    multiply(int_type xre, int_type xim, int_type yre, int_type yim, int_type& re, int_type& im) noexcept -> void
+    {
+        auto const wide = [](int_type v) { return std::int64_t(v); };
+        re = narrow(wide(xre) * wide(yre) - wide(xim) * wide(yim));
+        im = narrow(sum_products(wide(xre) * wide(yim), wide(xim) * wide(yre)));
+    }
+};
+
+#if defined(NEO_HAS_ISA_AVX512BW)
+    #define NEO_HAS_SIMD_FIXED_POINT_COMPLEX_MULTIPLY
+
+struct fixed_point_complex_batch
+{
+    using vec = __m512i;
+
+    static constexpr auto const bytes = std::size_t(64);
+
+    NEO_ALWAYS_INLINE static auto load(void const* p) noexcept -> vec { return _mm512_loadu_si512(p); }
+    NEO_ALWAYS_INLINE static auto store(void* p, vec v) noexcept -> void { _mm512_storeu_si512(p, v); }
+
+    NEO_ALWAYS_INLINE static auto set1_epi32(std::int32_t v) noexcept -> vec { return _mm512_set1_epi32(v); }
+    NEO_ALWAYS_INLINE static auto set1_epi64(std::int64_t v) noexcept -> vec { return _mm512_set1_epi64(v); }
+
+    NEO_ALWAYS_INLINE static auto and_(vec a, vec b) noexcept -> vec { return _mm512_and_si512(a, b); }
+    NEO_ALWAYS_INLINE static auto or_(vec a, vec b) noexcept -> vec { return _mm512_or_si512(a, b); }
+    NEO_ALWAYS_INLINE static auto xor_(vec a, vec b) noexcept -> vec { return _mm512_xor_si512(a, b); }
+
+    NEO_ALWAYS_INLINE static auto add_epi32(vec a, vec b) noexcept -> vec { return _mm512_add_epi32(a, b); }
+    NEO_ALWAYS_INLINE static auto add_epi64(vec a, vec b) noexcept -> vec { return _mm512_add_epi64(a, b); }
+    NEO_ALWAYS_INLINE static auto sub_epi64(vec a, vec b) noexcept -> vec { return _mm512_sub_epi64(a, b); }
+    NEO_ALWAYS_INLINE static auto adds_epi16(vec a, vec b) noexcept -> vec { return _mm512_adds_epi16(a, b); }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto srai_epi32(vec a) noexcept -> vec
+    {
+        return _mm512_srai_epi32(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto srli_epi32(vec a) noexcept -> vec
+    {
+        return _mm512_srli_epi32(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto slli_epi32(vec a) noexcept -> vec
+    {
+        return _mm512_slli_epi32(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto srli_epi64(vec a) noexcept -> vec
+    {
+        return _mm512_srli_epi64(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto slli_epi64(vec a) noexcept -> vec
+    {
+        return _mm512_slli_epi64(a, N);
+    }
+
+    NEO_ALWAYS_INLINE static auto madd_epi16(vec a, vec b) noexcept -> vec { return _mm512_madd_epi16(a, b); }
+    NEO_ALWAYS_INLINE static auto mul_epi32(vec a, vec b) noexcept -> vec { return _mm512_mul_epi32(a, b); }
+    NEO_ALWAYS_INLINE static auto packs_epi32(vec a, vec b) noexcept -> vec { return _mm512_packs_epi32(a, b); }
+    NEO_ALWAYS_INLINE static auto unpacklo_epi16(vec a, vec b) noexcept -> vec { return _mm512_unpacklo_epi16(a, b); }
+    NEO_ALWAYS_INLINE static auto unpackhi_epi16(vec a, vec b) noexcept -> vec { return _mm512_unpackhi_epi16(a, b); }
+
+    // [a0 a1 a2 a3 b0 b1 b2 b3] -> [a0 b0 a1 b1 a2 b2 a3 b3] in every 128-bit lane
+    NEO_ALWAYS_INLINE static auto interleave_epi16(vec v) noexcept -> vec
+    {
+        auto const mask = _mm_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+        return _mm512_shuffle_epi8(v, _mm512_broadcast_i32x4(mask));
+    }
+
+    // b where the sign bit of the 32-bit mask is set, otherwise a
+    NEO_ALWAYS_INLINE static auto blendv_epi32(vec a, vec b, vec mask) noexcept -> vec
+    {
+        return _mm512_mask_blend_epi32(_mm512_cmplt_epi32_mask(mask, _mm512_setzero_si512()), a, b);
+    }
+
+    // Even 32-bit elements of a, odd ones of b
+    NEO_ALWAYS_INLINE static auto blend_odd_epi32(vec a, vec b) noexcept -> vec
+    {
+        return _mm512_mask_blend_epi32(0xAAAA, a, b);
+    }
+
+    NEO_ALWAYS_INLINE static auto replace_epi32(vec v, std::int32_t value, std::int32_t replacement) noexcept -> vec
+    {
+        return _mm512_mask_mov_epi32(v, _mm512_cmpeq_epi32_mask(v, set1_epi32(value)), set1_epi32(replacement));
+    }
+
+    NEO_ALWAYS_INLINE static auto replace_epi64(vec v, std::int64_t value, std::int64_t replacement) noexcept -> vec
+    {
+        return _mm512_mask_mov_epi64(v, _mm512_cmpeq_epi64_mask(v, set1_epi64(value)), set1_epi64(replacement));
+    }
+};
+
+#elif defined(NEO_HAS_ISA_AVX2)
+    #define NEO_HAS_SIMD_FIXED_POINT_COMPLEX_MULTIPLY
+
+struct fixed_point_complex_batch
+{
+    using vec = __m256i;
+
+    static constexpr auto const bytes = std::size_t(32);
+
+    NEO_ALWAYS_INLINE static auto load(void const* p) noexcept -> vec
+    {
+        return _mm256_loadu_si256(static_cast<vec const*>(p));
+    }
+
+    NEO_ALWAYS_INLINE static auto store(void* p, vec v) noexcept -> void { _mm256_storeu_si256(static_cast<vec*>(p), v); }
+
+    NEO_ALWAYS_INLINE static auto set1_epi32(std::int32_t v) noexcept -> vec { return _mm256_set1_epi32(v); }
+    NEO_ALWAYS_INLINE static auto set1_epi64(std::int64_t v) noexcept -> vec { return _mm256_set1_epi64x(v); }
+
+    NEO_ALWAYS_INLINE static auto and_(vec a, vec b) noexcept -> vec { return _mm256_and_si256(a, b); }
+    NEO_ALWAYS_INLINE static auto or_(vec a, vec b) noexcept -> vec { return _mm256_or_si256(a, b); }
+    NEO_ALWAYS_INLINE static auto xor_(vec a, vec b) noexcept -> vec { return _mm256_xor_si256(a, b); }
+
+    NEO_ALWAYS_INLINE static auto add_epi32(vec a, vec b) noexcept -> vec { return _mm256_add_epi32(a, b); }
+    NEO_ALWAYS_INLINE static auto add_epi64(vec a, vec b) noexcept -> vec { return _mm256_add_epi64(a, b); }
+    NEO_ALWAYS_INLINE static auto sub_epi64(vec a, vec b) noexcept -> vec { return _mm256_sub_epi64(a, b); }
+    NEO_ALWAYS_INLINE static auto adds_epi16(vec a, vec b) noexcept -> vec { return _mm256_adds_epi16(a, b); }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto srai_epi32(vec a) noexcept -> vec
+    {
+        return _mm256_srai_epi32(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto srli_epi32(vec a) noexcept -> vec
+    {
+        return _mm256_srli_epi32(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto slli_epi32(vec a) noexcept -> vec
+    {
+        return _mm256_slli_epi32(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto srli_epi64(vec a) noexcept -> vec
+    {
+        return _mm256_srli_epi64(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto slli_epi64(vec a) noexcept -> vec
+    {
+        return _mm256_slli_epi64(a, N);
+    }
+
+    NEO_ALWAYS_INLINE static auto madd_epi16(vec a, vec b) noexcept -> vec { return _mm256_madd_epi16(a, b); }
+    NEO_ALWAYS_INLINE static auto mul_epi32(vec a, vec b) noexcept -> vec { return _mm256_mul_epi32(a, b); }
+    NEO_ALWAYS_INLINE static auto packs_epi32(vec a, vec b) noexcept -> vec { return _mm256_packs_epi32(a, b); }
+    NEO_ALWAYS_INLINE static auto unpacklo_epi16(vec a, vec b) noexcept -> vec { return _mm256_unpacklo_epi16(a, b); }
+    NEO_ALWAYS_INLINE static auto unpackhi_epi16(vec a, vec b) noexcept -> vec { return _mm256_unpackhi_epi16(a, b); }
+
+    // [a0 a1 a2 a3 b0 b1 b2 b3] -> [a0 b0 a1 b1 a2 b2 a3 b3] in every 128-bit lane
+    NEO_ALWAYS_INLINE static auto interleave_epi16(vec v) noexcept -> vec
+    {
+        auto const mask = _mm_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+        return _mm256_shuffle_epi8(v, _mm256_broadcastsi128_si256(mask));
+    }
+
+    // b where the sign bit of the 32-bit mask is set, otherwise a
+    NEO_ALWAYS_INLINE static auto blendv_epi32(vec a, vec b, vec mask) noexcept -> vec
+    {
+        return _mm256_castps_si256(
+            _mm256_blendv_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _mm256_castsi256_ps(mask))
+        );
+    }
+
+    // Even 32-bit elements of a, odd ones of b
+    NEO_ALWAYS_INLINE static auto blend_odd_epi32(vec a, vec b) noexcept -> vec { return _mm256_blend_epi32(a, b, 0xAA); }
+
+    NEO_ALWAYS_INLINE static auto replace_epi32(vec v, std::int32_t value, std::int32_t replacement) noexcept -> vec
+    {
+        return _mm256_blendv_epi8(v, set1_epi32(replacement), _mm256_cmpeq_epi32(v, set1_epi32(value)));
+    }
+
+    NEO_ALWAYS_INLINE static auto replace_epi64(vec v, std::int64_t value, std::int64_t replacement) noexcept -> vec
+    {
+        return _mm256_blendv_epi8(v, set1_epi64(replacement), _mm256_cmpeq_epi64(v, set1_epi64(value)));
+    }
+};
+
+#elif defined(NEO_HAS_ISA_SSE41)
+    #define NEO_HAS_SIMD_FIXED_POINT_COMPLEX_MULTIPLY
+
+struct fixed_point_complex_batch
+{
+    using vec = __m128i;
+
+    static constexpr auto const bytes = std::size_t(16);
+
+    NEO_ALWAYS_INLINE static auto load(void const* p) noexcept -> vec { return _mm_loadu_si128(static_cast<vec const*>(p)); }
+    NEO_ALWAYS_INLINE static auto store(void* p, vec v) noexcept -> void { _mm_storeu_si128(static_cast<vec*>(p), v); }
+
+    NEO_ALWAYS_INLINE static auto set1_epi32(std::int32_t v) noexcept -> vec { return _mm_set1_epi32(v); }
+    NEO_ALWAYS_INLINE static auto set1_epi64(std::int64_t v) noexcept -> vec { return _mm_set1_epi64x(v); }
+
+    NEO_ALWAYS_INLINE static auto and_(vec a, vec b) noexcept -> vec { return _mm_and_si128(a, b); }
+    NEO_ALWAYS_INLINE static auto or_(vec a, vec b) noexcept -> vec { return _mm_or_si128(a, b); }
+    NEO_ALWAYS_INLINE static auto xor_(vec a, vec b) noexcept -> vec { return _mm_xor_si128(a, b); }
+
+    NEO_ALWAYS_INLINE static auto add_epi32(vec a, vec b) noexcept -> vec { return _mm_add_epi32(a, b); }
+    NEO_ALWAYS_INLINE static auto add_epi64(vec a, vec b) noexcept -> vec { return _mm_add_epi64(a, b); }
+    NEO_ALWAYS_INLINE static auto sub_epi64(vec a, vec b) noexcept -> vec { return _mm_sub_epi64(a, b); }
+    NEO_ALWAYS_INLINE static auto adds_epi16(vec a, vec b) noexcept -> vec { return _mm_adds_epi16(a, b); }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto srai_epi32(vec a) noexcept -> vec
+    {
+        return _mm_srai_epi32(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto srli_epi32(vec a) noexcept -> vec
+    {
+        return _mm_srli_epi32(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto slli_epi32(vec a) noexcept -> vec
+    {
+        return _mm_slli_epi32(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto srli_epi64(vec a) noexcept -> vec
+    {
+        return _mm_srli_epi64(a, N);
+    }
+
+    template<int N>
+    NEO_ALWAYS_INLINE static auto slli_epi64(vec a) noexcept -> vec
+    {
+        return _mm_slli_epi64(a, N);
+    }
+
+    NEO_ALWAYS_INLINE static auto madd_epi16(vec a, vec b) noexcept -> vec { return _mm_madd_epi16(a, b); }
+    NEO_ALWAYS_INLINE static auto mul_epi32(vec a, vec b) noexcept -> vec { return _mm_mul_epi32(a, b); }
+    NEO_ALWAYS_INLINE static auto packs_epi32(vec a, vec b) noexcept -> vec { return _mm_packs_epi32(a, b); }
+    NEO_ALWAYS_INLINE static auto unpacklo_epi16(vec a, vec b) noexcept -> vec { return _mm_unpacklo_epi16(a, b); }
+    NEO_ALWAYS_INLINE static auto unpackhi_epi16(vec a, vec b) noexcept -> vec { return _mm_unpackhi_epi16(a, b); }
+
+    // [a0 a1 a2 a3 b0 b1 b2 b3] -> [a0 b0 a1 b1 a2 b2 a3 b3]
+    NEO_ALWAYS_INLINE static auto interleave_epi16(vec v) noexcept -> vec
+    {
+        return _mm_shuffle_epi8(v, _mm_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15));
+    }
+
+    // b where the sign bit of the 32-bit mask is set, otherwise a
+    NEO_ALWAYS_INLINE static auto blendv_epi32(vec a, vec b, vec mask) noexcept -> vec
+    {
+        return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _mm_castsi128_ps(mask)));
+    }
+
+    // Even 32-bit elements of a, odd ones of b
+    NEO_ALWAYS_INLINE static auto blend_odd_epi32(vec a, vec b) noexcept -> vec { return _mm_blend_epi16(a, b, 0xCC); }
+
+    NEO_ALWAYS_INLINE static auto replace_epi32(vec v, std::int32_t value, std::int32_t replacement) noexcept -> vec
+    {
+        return _mm_blendv_epi8(v, set1_epi32(replacement), _mm_cmpeq_epi32(v, set1_epi32(value)));
+    }
+
+    NEO_ALWAYS_INLINE static auto replace_epi64(vec v, std::int64_t value, std::int64_t replacement) noexcept -> vec
+    {
+        return _mm_blendv_epi8(v, set1_epi64(replacement), _mm_cmpeq_epi64(v, set1_epi64(value)));
+    }
+};
+
+#endif
+
+#if defined(NEO_HAS_SIMD_FIXED_POINT_COMPLEX_MULTIPLY)
+
+/// \brief Rounded real & imaginary parts of q15 (re, im) pairs, as 32-bit integers.
+///
+/// Uses ~im = -im - 1, which never overflows: x.re * y.re + x.im * ~y.im + x.im
+/// is the real part. pmaddwd only wraps if all four factors are -1, those sums
+/// are replaced by values that still saturate after the final pack.
+template<typename Batch>
+NEO_ALWAYS_INLINE auto
+q15_complex_multiply(typename Batch::vec x, typename Batch::vec y, typename Batch::vec& re, typename Batch::vec& im)
+    noexcept -> void
+{
+    using b = Batch;
+
+    auto const round   = b::set1_epi32(1 << 14);
+    auto const not_im  = b::xor_(y, b::set1_epi32(static_cast<std::int32_t>(0xFFFF0000U)));
+    auto const swapped = b::or_(b::template slli_epi32<16>(y), b::template srli_epi32<16>(y));
+
+    auto const real = b::add_epi32(
+        b::replace_epi32(b::madd_epi16(x, not_im), std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max()),
+        b::template srai_epi32<16>(x)
+    );
+    auto const imag = b::replace_epi32(b::madd_epi16(x, swapped), std::numeric_limits<std::int32_t>::min(), 1 << 30);
+
+    re = b::template srai_epi32<15>(b::add_epi32(real, round));
+    im = b::template srai_epi32<15>(b::add_epi32(imag, round));
+}
+
+/// Saturated int32 of the rounded 64-bit lanes, in the even 32-bit elements.
+template<typename Batch>
+NEO_ALWAYS_INLINE auto q31_narrow(typename Batch::vec v) noexcept -> typename Batch::vec
+{
+    using b = Batch;
+
+    // Fits iff bit 62 equals the sign bit
+    auto const lo       = b::template srli_epi64<31>(v);
+    auto const hi       = b::template srli_epi64<32>(v);
+    auto const overflow = b::template srai_epi32<31>(b::xor_(hi, b::template slli_epi32<1>(hi)));
+    auto const limit    = b::xor_(b::template srai_epi32<31>(hi), b::set1_epi32(std::numeric_limits<std::int32_t>::max()));
+    return b::blendv_epi32(lo, limit, overflow);
+}
+
+/// Complex product of the q31 values in the even 32-bit elements.
+template<typename Batch>
+NEO_ALWAYS_INLINE auto q31_complex_multiply(
+    typename Batch::vec xre,
+    typename Batch::vec xim,
+    typename Batch::vec yre,
+    typename Batch::vec yim,
+    typename Batch::vec& re,
+    typename Batch::vec& im
+) noexcept -> void
+{
+    using b = Batch;
+
+    auto const round = b::set1_epi64(std::int64_t(1) << 30);
+    auto const real  = b::sub_epi64(b::mul_epi32(xre, yre), b::mul_epi32(xim, yim));
+    auto const imag  = b::replace_epi64(
+        b::add_epi64(b::mul_epi32(xre, yim), b::mul_epi32(xim, yre)),
+        std::numeric_limits<std::int64_t>::min(),
+        std::int64_t(1) << 62
+    );
+
+    re = q31_narrow<Batch>(b::add_epi64(real, round));
+    im = q31_narrow<Batch>(b::add_epi64(imag, round));
+}
+
+template<typename Batch>
+NEO_ALWAYS_INLINE auto adds_epi32(typename Batch::vec x, typename Batch::vec y) noexcept -> typename Batch::vec
+{
+    using b = Batch;
+
+    auto const sum      = b::add_epi32(x, y);
+    auto const overflow = b::and_(b::xor_(sum, x), b::xor_(sum, y));
+    auto const limit    = b::xor_(b::template srai_epi32<31>(x), b::set1_epi32(std::numeric_limits<std::int32_t>::max()));
+    return b::blendv_epi32(sum, limit, overflow);
+}
+
+template<typename Batch>
+NEO_ALWAYS_INLINE auto q31_interleaved_multiply(typename Batch::vec x, typename Batch::vec y) noexcept ->
+    typename Batch::vec
+{
+    using b = Batch;
+
+    auto re = typename Batch::vec{};
+    auto im = typename Batch::vec{};
+    q31_complex_multiply<Batch>(x, b::template srli_epi64<32>(x), y, b::template srli_epi64<32>(y), re, im);
+    return b::blend_odd_epi32(re, b::template slli_epi64<32>(im));
+}
+
+#endif
+
+/// out = x * y + z, with z = nullptr for out = x * y. The pointers may alias.
+template<q15_or_q31 FixedPoint>
+auto complex_multiply_add(
+    fixed_point_complex<FixedPoint> const* x,
+    fixed_point_complex<FixedPoint> const* y,
+    fixed_point_complex<FixedPoint> const* z,
+    fixed_point_complex<FixedPoint>* out,
+    std::size_t size
+) noexcept -> void
+{
+    using math = fixed_point_complex_math<FixedPoint>;
+    using Int  = typename FixedPoint::storage_type;
+
+    auto i = std::size_t(0);
+
+#if defined(NEO_HAS_SIMD_FIXED_POINT_COMPLEX_MULTIPLY)
+    using b = fixed_point_complex_batch;
+
+    static constexpr auto const inc = b::bytes / sizeof(fixed_point_complex<FixedPoint>);
+
+    for (; i + inc <= size; i += inc) {
+        auto const xv = b::load(&x[i]);
+        auto const yv = b::load(&y[i]);
+
+        auto result = typename b::vec{};
+        if constexpr (std::same_as<FixedPoint, q15>) {
+            auto re = typename b::vec{};
+            auto im = typename b::vec{};
+            q15_complex_multiply<b>(xv, yv, re, im);
+            result = b::interleave_epi16(b::packs_epi32(re, im));
+            if (z != nullptr) {
+                result = b::adds_epi16(result, b::load(&z[i]));
+            }
+        } else {
+            result = q31_interleaved_multiply<b>(xv, yv);
+            if (z != nullptr) {
+                result = adds_epi32<b>(result, b::load(&z[i]));
+            }
+        }
+        b::store(&out[i], result);
+    }
+#endif
+
+    for (; i < size; ++i) {
+        auto re = Int{};
+        auto im = Int{};
+        math::multiply(x[i].real().value(), x[i].imag().value(), y[i].real().value(), y[i].imag().value(), re, im);
+        if (z != nullptr) {
+            re = math::add(re, z[i].real().value());
+            im = math::add(im, z[i].imag().value());
+        }
+        out[i] = fixed_point_complex<FixedPoint>{
+            FixedPoint{underlying_value, re},
+            FixedPoint{underlying_value, im},
+        };
+    }
+}
+
+/// out = x * y + z on split rows, with z_real = nullptr for out = x * y. The pointers may alias.
+template<q15_or_q31 FixedPoint>
+auto complex_multiply_add(
+    FixedPoint const* x_real,
+    FixedPoint const* x_imag,
+    FixedPoint const* y_real,
+    FixedPoint const* y_imag,
+    FixedPoint const* z_real,
+    FixedPoint const* z_imag,
+    FixedPoint* out_real,
+    FixedPoint* out_imag,
+    std::size_t size
+) noexcept -> void
+{
+    using math = fixed_point_complex_math<FixedPoint>;
+    using Int  = typename FixedPoint::storage_type;
+
+    auto i = std::size_t(0);
+
+#if defined(NEO_HAS_SIMD_FIXED_POINT_COMPLEX_MULTIPLY)
+    using b = fixed_point_complex_batch;
+
+    static constexpr auto const inc = b::bytes / sizeof(FixedPoint);
+
+    for (; i + inc <= size; i += inc) {
+        auto const xre = b::load(&x_real[i]);
+        auto const xim = b::load(&x_imag[i]);
+        auto const yre = b::load(&y_real[i]);
+        auto const yim = b::load(&y_imag[i]);
+
+        auto re = typename b::vec{};
+        auto im = typename b::vec{};
+
+        if constexpr (std::same_as<FixedPoint, q15>) {
+            auto re_lo = typename b::vec{};
+            auto im_lo = typename b::vec{};
+            auto re_hi = typename b::vec{};
+            auto im_hi = typename b::vec{};
+            q15_complex_multiply<b>(b::unpacklo_epi16(xre, xim), b::unpacklo_epi16(yre, yim), re_lo, im_lo);
+            q15_complex_multiply<b>(b::unpackhi_epi16(xre, xim), b::unpackhi_epi16(yre, yim), re_hi, im_hi);
+            re = b::packs_epi32(re_lo, re_hi);
+            im = b::packs_epi32(im_lo, im_hi);
+            if (z_real != nullptr) {
+                re = b::adds_epi16(re, b::load(&z_real[i]));
+                im = b::adds_epi16(im, b::load(&z_imag[i]));
+            }
+        } else {
+            auto re_even = typename b::vec{};
+            auto im_even = typename b::vec{};
+            auto re_odd  = typename b::vec{};
+            auto im_odd  = typename b::vec{};
+
+            auto const odd = [](auto v) { return b::template srli_epi64<32>(v); };
+            q31_complex_multiply<b>(xre, xim, yre, yim, re_even, im_even);
+            q31_complex_multiply<b>(odd(xre), odd(xim), odd(yre), odd(yim), re_odd, im_odd);
+
+            re = b::blend_odd_epi32(re_even, b::template slli_epi64<32>(re_odd));
+            im = b::blend_odd_epi32(im_even, b::template slli_epi64<32>(im_odd));
+            if (z_real != nullptr) {
+                re = adds_epi32<b>(re, b::load(&z_real[i]));
+                im = adds_epi32<b>(im, b::load(&z_imag[i]));
+            }
+        }
+
+        b::store(&out_real[i], re);
+        b::store(&out_imag[i], im);
+    }
+#endif
+
+    for (; i < size; ++i) {
+        auto re = Int{};
+        auto im = Int{};
+        math::multiply(x_real[i].value(), x_imag[i].value(), y_real[i].value(), y_imag[i].value(), re, im);
+        if (z_real != nullptr) {
+            re = math::add(re, z_real[i].value());
+            im = math::add(im, z_imag[i].value());
+        }
+        out_real[i] = FixedPoint{underlying_value, re};
+        out_imag[i] = FixedPoint{underlying_value, im};
+    }
+}
+
+}  // namespace detail
+
+/// \brief out[i] = x[i] * y[i], rounded to nearest and saturated.
+///
+/// The real & imaginary parts are computed from the exact 32-bit (q15) or
+/// 64-bit (q31) sums of products, unlike fixed_point_complex::operator*.
+///
+/// \ingroup neo-fixed-point
+template<in_object InObj1, in_object InObj2, out_object OutObj>
+    requires(
+        detail::all_same_rank<InObj1, InObj2, OutObj> and InObj1::rank() == 1
+        and detail::complex_q15_or_q31<value_type_t<OutObj>>
+        and std::same_as<value_type_t<InObj1>, value_type_t<OutObj>>
+        and std::same_as<value_type_t<InObj2>, value_type_t<OutObj>>
+    )
+auto multiply(InObj1 x, InObj2 y, OutObj out) noexcept -> void
+{
+    assert(neo::detail::extents_equal(x, y, out));
+
+    using Complex = value_type_t<OutObj>;
+
+    if constexpr (always_vectorizable<InObj1, InObj2, OutObj>) {
+        auto const size = static_cast<std::size_t>(x.extent(0));
+        detail::complex_multiply_add(x.data_handle(), y.data_handle(), static_cast<Complex const*>(nullptr), out.data_handle(), size);
+    } else {
+        for (auto i = std::size_t(0); i < static_cast<std::size_t>(x.extent(0)); ++i) {
+            Complex const xv = x[i];
+            Complex const yv = y[i];
+            detail::complex_multiply_add(&xv, &yv, static_cast<Complex const*>(nullptr), &out[i], 1);
+        }
+    }
+}
+
+/// \brief out[i] = x[i] * y[i] + z[i], rounded to nearest and saturated.
+/// \ingroup neo-fixed-point
+template<in_vector VecX, in_vector VecY, in_vector VecZ, out_vector VecOut>
+    requires(
+        detail::complex_q15_or_q31<value_type_t<VecOut>> and std::same_as<value_type_t<VecX>, value_type_t<VecOut>>
+        and std::same_as<value_type_t<VecY>, value_type_t<VecOut>>
+        and std::same_as<value_type_t<VecZ>, value_type_t<VecOut>>
+    )
+auto multiply_add(VecX x, VecY y, VecZ z, VecOut out) noexcept -> void
+{
+    assert(neo::detail::extents_equal(x, y, z, out));
+
+    if constexpr (always_vectorizable<VecX, VecY, VecZ, VecOut>) {
+        auto const size = static_cast<std::size_t>(x.extent(0));
+        detail::complex_multiply_add(x.data_handle(), y.data_handle(), z.data_handle(), out.data_handle(), size);
+    } else {
+        using Complex = value_type_t<VecOut>;
+        for (auto i = std::size_t(0); i < static_cast<std::size_t>(x.extent(0)); ++i) {
+            Complex const xv = x[i];
+            Complex const yv = y[i];
+            Complex const zv = z[i];
+            detail::complex_multiply_add(&xv, &yv, &zv, &out[i], 1);
+        }
+    }
+}
+
+/// \brief out[i] = x[i] * y[i], rounded to nearest and saturated.
+/// \ingroup neo-fixed-point
+template<in_vector VecX, in_vector VecY, out_vector VecOut>
+    requires(
+        detail::q15_or_q31<value_type_t<VecOut>> and std::same_as<value_type_t<VecX>, value_type_t<VecOut>>
+        and std::same_as<value_type_t<VecY>, value_type_t<VecOut>>
+    )
+auto multiply(split_complex<VecX> x, split_complex<VecY> y, split_complex<VecOut> out) noexcept -> void
+{
+    assert(neo::detail::extents_equal(x.real, x.imag, y.real, y.imag, out.real, out.imag));
+
+    using Fixed = value_type_t<VecOut>;
+
+    if constexpr (always_vectorizable<VecX, VecY, VecOut>) {
+        detail::complex_multiply_add(
+            x.real.data_handle(),
+            x.imag.data_handle(),
+            y.real.data_handle(),
+            y.imag.data_handle(),
+            static_cast<Fixed const*>(nullptr),
+            static_cast<Fixed const*>(nullptr),
+            out.real.data_handle(),
+            out.imag.data_handle(),
+            static_cast<std::size_t>(x.real.extent(0))
+        );
+    } else {
+        for (auto i = std::size_t(0); i < static_cast<std::size_t>(x.real.extent(0)); ++i) {
+            Fixed const xre = x.real[i];
+            Fixed const xim = x.imag[i];
+            Fixed const yre = y.real[i];
+            Fixed const yim = y.imag[i];
+            detail::complex_multiply_add(
+                &xre,
+                &xim,
+                &yre,
+                &yim,
+                static_cast<Fixed const*>(nullptr),
+                static_cast<Fixed const*>(nullptr),
+                &out.real[i],
+                &out.imag[i],
+                1
+            );
+        }
+    }
+}
+
+/// \brief out[i] = x[i] * y[i] + z[i], rounded to nearest and saturated.
+/// \ingroup neo-fixed-point
+template<in_vector VecX, in_vector VecY, in_vector VecZ, out_vector VecOut>
+    requires(
+        detail::q15_or_q31<value_type_t<VecOut>> and std::same_as<value_type_t<VecX>, value_type_t<VecOut>>
+        and std::same_as<value_type_t<VecY>, value_type_t<VecOut>>
+        and std::same_as<value_type_t<VecZ>, value_type_t<VecOut>>
+    )
+auto multiply_add(split_complex<VecX> x, split_complex<VecY> y, split_complex<VecZ> z, split_complex<VecOut> out) noexcept
+    -> void
+{
+    assert(neo::detail::extents_equal(x.real, x.imag, y.real, y.imag, z.real, z.imag, out.real, out.imag));
+
+    using Fixed = value_type_t<VecOut>;
+
+    if constexpr (always_vectorizable<VecX, VecY, VecZ, VecOut>) {
+        detail::complex_multiply_add(
+            x.real.data_handle(),
+            x.imag.data_handle(),
+            y.real.data_handle(),
+            y.imag.data_handle(),
+            z.real.data_handle(),
+            z.imag.data_handle(),
+            out.real.data_handle(),
+            out.imag.data_handle(),
+            static_cast<std::size_t>(x.real.extent(0))
+        );
+    } else {
+        for (auto i = std::size_t(0); i < static_cast<std::size_t>(x.real.extent(0)); ++i) {
+            Fixed const xre = x.real[i];
+            Fixed const xim = x.imag[i];
+            Fixed const yre = y.real[i];
+            Fixed const yim = y.imag[i];
+            Fixed const zre = z.real[i];
+            Fixed const zim = z.imag[i];
+            detail::complex_multiply_add(&xre, &xim, &yre, &yim, &zre, &zim, &out.real[i], &out.imag[i], 1);
+        }
+    }
+}
+
+}  // namespace neo
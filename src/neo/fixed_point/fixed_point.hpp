@@ -13,13 +13,17 @@ namespace neo {
 namespace detail {
 
 template<typename IntType>
-constexpr auto saturate(std::int32_t x) -> IntType
+constexpr auto saturate(std::int64_t x) -> IntType
 {
-    auto const min_v = static_cast<std::int32_t>(std::numeric_limits<IntType>::min());
-    auto const max_v = static_cast<std::int32_t>(std::numeric_limits<IntType>::max());
+    auto const min_v = static_cast<std::int64_t>(std::numeric_limits<IntType>::min());
+    auto const max_v = static_cast<std::int64_t>(std::numeric_limits<IntType>::max());
     return static_cast<IntType>(std::clamp(x, min_v, max_v));
 }
 
+/// Holds the sum or product of two values without overflow.
+template<typename IntType>
+using fixed_point_wide_t = std::conditional_t<(sizeof(IntType) < 4), std::int32_t, std::int64_t>;
+
 }  // namespace detail
 
 struct underlying_value_t
@@ -34,25 +38,24 @@ struct fixed_point
 {
     using storage_type = IntType;
     using value_type   = IntType;
+    using wide_type    = detail::fixed_point_wide_t<IntType>;
 
     static constexpr auto const integer_bits    = std::numeric_limits<IntType>::digits - FractionalBits;
     static constexpr auto const fractional_bits = FractionalBits;
-    static constexpr auto const scale           = static_cast<float>(1 << FractionalBits);
+    static constexpr auto const scale           = static_cast<float>(std::int64_t(1) << FractionalBits);
     static constexpr auto const inv_scale       = 1.0F / scale;
 
     constexpr fixed_point() = default;
 
     template<std::floating_point Float>
-    explicit constexpr fixed_point(Float val) noexcept
-        : _value{detail::saturate<storage_type>(static_cast<std::int32_t>(static_cast<float>(val) * scale))}
-    {}
+    explicit constexpr fixed_point(Float val) noexcept : _value{from_float(val)} {}
 
     constexpr fixed_point([[maybe_unused]] underlying_value_t tag, storage_type val) noexcept : _value{val} {}
 
     template<std::floating_point Float>
     [[nodiscard]] constexpr explicit operator Float() const noexcept
     {
-        return static_cast<float>(_value) * inv_scale;
+        return static_cast<Float>(_value) * static_cast<Float>(inv_scale);
     }
 
     [[nodiscard]] constexpr auto value() const noexcept -> storage_type { return _value; }
@@ -74,7 +77,7 @@ struct fixed_point
     {
         return {
             underlying_value,
-            detail::saturate<IntType>(lhs.value() + rhs.value()),
+            detail::saturate<IntType>(wide_type(lhs.value()) + wide_type(rhs.value())),
         };
     }
 
@@ -82,7 +85,7 @@ struct fixed_point
     {
         return {
             underlying_value,
-            detail::saturate<IntType>(lhs.value() - rhs.value()),
+            detail::saturate<IntType>(wide_type(lhs.value()) - wide_type(rhs.value())),
         };
     }
 
@@ -90,7 +93,7 @@ struct fixed_point
     {
         return {
             underlying_value,
-            detail::saturate<IntType>((lhs.value() * rhs.value()) >> fractional_bits),
+            detail::saturate<IntType>((wide_type(lhs.value()) * wide_type(rhs.value())) >> fractional_bits),
         };
     }
 
@@ -107,6 +110,17 @@ struct fixed_point
     friend constexpr auto operator>=(fixed_point lhs, fixed_point rhs) -> bool { return lhs.value() >= rhs.value(); }
 
 private:
+    /// Up to 16 bits the value is scaled in float, a float can't hold the 31 fractional bits of q31.
+    template<std::floating_point Float>
+    [[nodiscard]] static constexpr auto from_float(Float val) noexcept -> storage_type
+    {
+        if constexpr (sizeof(IntType) < 4) {
+            return detail::saturate<storage_type>(static_cast<std::int32_t>(static_cast<float>(val) * scale));
+        } else {
+            return detail::saturate<storage_type>(static_cast<std::int64_t>(static_cast<double>(val) * double(scale)));
+        }
+    }
+
     IntType _value;
 };
 
@@ -124,6 +138,7 @@ template<std::signed_integral IntType, int FractionalBits>
 
 using q7  = fixed_point<std::int8_t, 7>;
 using q15 = fixed_point<std::int16_t, 15>;
+using q31 = fixed_point<std::int32_t, 31>;
 
 template<typename T>
 inline constexpr auto is_fixed_point = false;
@@ -2,15 +2,23 @@
 
 #include "algorithm.hpp"
 #include "complex.hpp"
+#include "complex_multiply.hpp"
 #include "fixed_point.hpp"
 #include "simd.hpp"
 
+#include <neo/algorithm/multiply.hpp>
+#include <neo/algorithm/multiply_add.hpp>
+
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include <functional>
+#include <limits>
+#include <random>
 #include <span>
 #include <utility>
 #include <vector>
@@ -449,6 +457,150 @@ TEST_CASE("neo/fixed_point: complex_q15")
     REQUIRE(product.imag().value() == 7);
 }
 
+TEST_CASE("neo/fixed_point: q31")
+{
+    STATIC_REQUIRE(neo::complex<neo::complex_q31>);
+
+    auto const half    = neo::q31{0.5};
+    auto const quarter = neo::q31{0.25};
+    REQUIRE(half.value() == 1 << 30);
+    REQUIRE(static_cast<double>(quarter) == Catch::Approx(0.25));
+    REQUIRE((half + half).value() == std::numeric_limits<std::int32_t>::max());
+    REQUIRE((half * quarter).value() == 1 << 28);
+    REQUIRE((quarter - half).value() == -(1 << 29));
+
+    // q15 rounds the input to float first, q31 keeps the bits below float precision
+    auto const below_half = 0.5 - 0x1p-30;
+    REQUIRE(neo::q15{below_half}.value() == neo::q15{0.5F}.value());
+    REQUIRE(neo::q31{below_half}.value() == (1 << 30) - 2);
+}
+
+TEMPLATE_TEST_CASE("neo/fixed_point: multiply(complex)", "", neo::q15, neo::q31)
+{
+    using Fixed   = TestType;
+    using Int     = typename Fixed::storage_type;
+    using Complex = neo::fixed_point_complex<Fixed>;
+    using Math    = neo::detail::fixed_point_complex_math<Fixed>;
+
+    static constexpr auto const min = std::numeric_limits<Int>::min();
+    static constexpr auto const max = std::numeric_limits<Int>::max();
+
+    auto const size = GENERATE(as<std::size_t>{}, 0, 1, 2, 7, 16, 33, 67, 128);
+    CAPTURE(size);
+
+    // Random bins, with the corner cases of the sums of products mixed in
+    auto rng      = std::mt19937{Catch::getSeed()};
+    auto dist     = std::uniform_int_distribution<Int>{min, max};
+    auto corners  = std::array{min, Int(min + 1), Int(-1), Int(0), Int(1), max};
+    auto generate = [&](std::size_t i) {
+        if (i % 3 == 0) {
+            return Fixed{neo::underlying_value, corners[static_cast<std::size_t>(rng() % corners.size())]};
+        }
+        return Fixed{neo::underlying_value, dist(rng)};
+    };
+
+    auto x = std::vector<Complex>(size);
+    auto y = std::vector<Complex>(size);
+    auto z = std::vector<Complex>(size);
+    for (auto i = std::size_t(0); i < size; ++i) {
+        x[i] = Complex{generate(i), generate(i)};
+        y[i] = Complex{generate(i), generate(i)};
+        z[i] = Complex{generate(i), generate(i)};
+    }
+    if (size > 0) {
+        x[0] = Complex{Fixed{neo::underlying_value, min}, Fixed{neo::underlying_value, min}};
+        y[0] = Complex{Fixed{neo::underlying_value, min}, Fixed{neo::underlying_value, min}};
+    }
+    if (size > 1) {
+        x[1] = Complex{Fixed{neo::underlying_value, min}, Fixed{neo::underlying_value, min}};
+        y[1] = Complex{Fixed{neo::underlying_value, min}, Fixed{neo::underlying_value, max}};
+    }
+
+    auto expected_product = std::vector<Complex>(size);
+    auto expected_sum     = std::vector<Complex>(size);
+    for (auto i = std::size_t(0); i < size; ++i) {
+        auto re = Int{};
+        auto im = Int{};
+        Math::multiply(x[i].real().value(), x[i].imag().value(), y[i].real().value(), y[i].imag().value(), re, im);
+        expected_product[i] = Complex{Fixed{neo::underlying_value, re}, Fixed{neo::underlying_value, im}};
+        expected_sum[i]     = Complex{
+            Fixed{neo::underlying_value, Math::add(re, z[i].real().value())},
+            Fixed{neo::underlying_value, Math::add(im, z[i].imag().value())},
+        };
+    }
+
+    auto const equal = [](std::vector<Complex> const& lhs, std::vector<Complex> const& rhs) {
+        for (auto i = std::size_t(0); i < lhs.size(); ++i) {
+            if (lhs[i].real() != rhs[i].real() or lhs[i].imag() != rhs[i].imag()) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (size > 1) {
+        REQUIRE(expected_product[0].real().value() == 0);
+        REQUIRE(expected_product[0].imag().value() == max);
+        REQUIRE(expected_product[1].real().value() == max);
+    }
+
+    auto const span = [](auto& vec) { return stdex::mdspan{vec.data(), stdex::extents{vec.size()}}; };
+
+    SECTION("interleaved")
+    {
+        auto out = std::vector<Complex>(size);
+        neo::multiply(span(std::as_const(x)), span(std::as_const(y)), span(out));
+        REQUIRE(equal(out, expected_product));
+
+        neo::multiply_add(span(std::as_const(x)), span(std::as_const(y)), span(std::as_const(z)), span(out));
+        REQUIRE(equal(out, expected_sum));
+
+        // Strided views take the scalar path
+        auto const strided = [size](auto& vec) {
+            using mapping = stdex::layout_stride::mapping<stdex::dextents<std::size_t, 1>>;
+            return stdex::mdspan{vec.data(), mapping{stdex::dextents<std::size_t, 1>{size}, std::array{1UL}}};
+        };
+        neo::multiply_add(strided(std::as_const(x)), strided(std::as_const(y)), strided(std::as_const(z)), strided(out));
+        REQUIRE(equal(out, expected_sum));
+    }
+
+    SECTION("split")
+    {
+        auto split = [size](std::vector<Complex> const& vec) {
+            auto result = stdex::mdarray<Fixed, stdex::dextents<std::size_t, 2>>{2, size};
+            for (auto i = std::size_t(0); i < size; ++i) {
+                result(0, i) = vec[i].real();
+                result(1, i) = vec[i].imag();
+            }
+            return result;
+        };
+        auto view = [](auto& arr) {
+            return neo::split_complex{
+                stdex::submdspan(arr.to_mdspan(), 0, stdex::full_extent),
+                stdex::submdspan(arr.to_mdspan(), 1, stdex::full_extent),
+            };
+        };
+        auto merge = [size](auto const& arr) {
+            auto result = std::vector<Complex>(size);
+            for (auto i = std::size_t(0); i < size; ++i) {
+                result[i] = Complex{arr(0, i), arr(1, i)};
+            }
+            return result;
+        };
+
+        auto const sx = split(x);
+        auto const sy = split(y);
+        auto const sz = split(z);
+        auto out      = split(z);
+
+        neo::multiply(view(sx), view(sy), view(out));
+        REQUIRE(equal(merge(out), expected_product));
+
+        neo::multiply_add(view(sx), view(sy), view(sz), view(out));
+        REQUIRE(equal(merge(out), expected_sum));
+    }
+}
+
 template<typename Batch>
 static auto test_simd_fixed_point()
 {
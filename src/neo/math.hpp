@@ -9,6 +9,7 @@
 
 #include <neo/math/a_weighting.hpp>
 #include <neo/math/abs.hpp>
+#include <neo/math/absolute_threshold_of_hearing.hpp>
 #include <neo/math/conj.hpp>
 #include <neo/math/fast_math.hpp>
 #include <neo/math/float_equality.hpp>
@@ -21,4 +22,5 @@
 #include <neo/math/polar.hpp>
 #include <neo/math/precision.hpp>
 #include <neo/math/real.hpp>
+#include <neo/math/scoped_flush_denormals.hpp>
 #include <neo/math/windowing.hpp>
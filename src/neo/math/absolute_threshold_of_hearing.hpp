@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cmath>
+#include <concepts>
+
+namespace neo {
+
+/// \brief Absolute threshold of hearing in dB SPL after Terhardt (1979).
+/// \pre \p frequency must be greater 0.0
+/// \ingroup neo-math
+template<std::floating_point Float>
+[[nodiscard]] auto absolute_threshold_of_hearing(Float frequency) noexcept -> Float
+{
+    auto const khz = frequency / Float(1000);
+    auto const dip = khz - Float(3.3);
+    return Float(3.64) * std::pow(khz, Float(-0.8))  //
+         - Float(6.5) * std::exp(Float(-0.6) * dip * dip)
+         + Float(0.001) * khz * khz * khz * khz;
+}
+
+}  // namespace neo
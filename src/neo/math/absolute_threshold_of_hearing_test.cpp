@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: MIT
+
+#include "absolute_threshold_of_hearing.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE("neo/math: absolute_threshold_of_hearing", "", float, double)
+{
+    using Float = TestType;
+
+    REQUIRE(neo::absolute_threshold_of_hearing(Float(100)) == Catch::Approx(22.95).margin(0.01));
+    REQUIRE(neo::absolute_threshold_of_hearing(Float(1000)) == Catch::Approx(3.37).margin(0.01));
+    REQUIRE(neo::absolute_threshold_of_hearing(Float(3300)) == Catch::Approx(-4.98).margin(0.01));
+    REQUIRE(neo::absolute_threshold_of_hearing(Float(16000)) == Catch::Approx(65.93).margin(0.05));
+
+    // Most sensitive between 3 and 4 kHz
+    REQUIRE(neo::absolute_threshold_of_hearing(Float(3300)) < neo::absolute_threshold_of_hearing(Float(1000)));
+    REQUIRE(neo::absolute_threshold_of_hearing(Float(3300)) < neo::absolute_threshold_of_hearing(Float(8000)));
+}
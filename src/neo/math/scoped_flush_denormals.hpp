@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#if defined(NEO_HAS_ISA_SSE2)
+    #include <immintrin.h>
+#endif
+
+#include <cstdint>
+
+namespace neo {
+
+/// \brief Enables flush-to-zero & denormals-are-zero for the calling thread, restores the previous mode on destruction.
+///
+/// Decaying tails in feedback and convolution state end up as denormals, which most CPUs process many times slower
+/// than normal floats. Uses MXCSR FTZ/DAZ on x86 and FPCR.FZ on AArch64, it's a no-op on other targets.
+///
+/// \ingroup neo-math
+struct scoped_flush_denormals
+{
+    /// False if constructing a scope has no effect on this target.
+    static constexpr auto const is_supported =
+#if defined(NEO_HAS_ISA_SSE2) or defined(__aarch64__)
+        true;
+#else
+        false;
+#endif
+
+    scoped_flush_denormals() noexcept;
+    ~scoped_flush_denormals() noexcept;
+
+    scoped_flush_denormals(scoped_flush_denormals const& other)                    = delete;
+    scoped_flush_denormals(scoped_flush_denormals&& other)                         = delete;
+    auto operator=(scoped_flush_denormals const& other) -> scoped_flush_denormals& = delete;
+    auto operator=(scoped_flush_denormals&& other) -> scoped_flush_denormals&      = delete;
+
+private:
+    std::uint64_t _previous{0};
+};
+
+inline scoped_flush_denormals::scoped_flush_denormals() noexcept
+{
+#if defined(NEO_HAS_ISA_SSE2)
+    static constexpr auto const flush_to_zero      = 0x8000U;
+    static constexpr auto const denormals_are_zero = 0x0040U;
+
+    auto const csr = _mm_getcsr();
+    _previous      = csr;
+    _mm_setcsr(csr | flush_to_zero | denormals_are_zero);
+#elif defined(__aarch64__)
+    static constexpr auto const flush_to_zero = std::uint64_t(1) << 24U;
+
+    auto fpcr = std::uint64_t(0);
+    asm volatile("mrs %0, fpcr" : "=r"(fpcr));
+    _previous = fpcr;
+    asm volatile("msr fpcr, %0" : : "r"(fpcr | flush_to_zero));
+#endif
+}
+
+inline scoped_flush_denormals::~scoped_flush_denormals() noexcept
+{
+#if defined(NEO_HAS_ISA_SSE2)
+    _mm_setcsr(static_cast<unsigned>(_previous));
+#elif defined(__aarch64__)
+    asm volatile("msr fpcr, %0" : : "r"(_previous));
+#endif
+}
+
+}  // namespace neo
@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: MIT
+
+#include "scoped_flush_denormals.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+#include <type_traits>
+
+TEST_CASE("neo/math: scoped_flush_denormals")
+{
+    STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<neo::scoped_flush_denormals>);
+    STATIC_REQUIRE_FALSE(std::is_move_constructible_v<neo::scoped_flush_denormals>);
+
+    if constexpr (neo::scoped_flush_denormals::is_supported) {
+        // volatile keeps the compiler from folding the products at compile time
+        volatile auto smallest = std::numeric_limits<float>::min();
+        volatile auto half     = 0.5F;
+        REQUIRE(smallest * half != 0.0F);
+
+        {
+            auto const outer = neo::scoped_flush_denormals{};
+            REQUIRE(smallest * half == 0.0F);
+
+            {
+                auto const inner = neo::scoped_flush_denormals{};
+                REQUIRE(smallest * half == 0.0F);
+            }
+
+            REQUIRE(smallest * half == 0.0F);
+        }
+
+        REQUIRE(smallest * half != 0.0F);
+    }
+}
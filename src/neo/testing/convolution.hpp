@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <neo/config.hpp>
+
+#include <neo/algorithm/copy.hpp>
+#include <neo/container/mdspan.hpp>
+#include <neo/convolution/uniform_partition.hpp>
+#include <neo/testing/testing.hpp>
+#include <neo/type_traits/value_type_t.hpp>
+
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <random>
+
+namespace neo {
+
+/// Uniformly partitions a mono impulse response, returns a num_partitions x num_bins matrix.
+template<in_vector InVec>
+    requires always_contiguous<InVec>
+[[nodiscard]] auto partition_impulse(InVec impulse, std::size_t block_size)
+    -> stdex::mdarray<std::complex<value_type_t<InVec>>, stdex::dextents<std::size_t, 2>>
+{
+    using Complex = std::complex<value_type_t<InVec>>;
+
+    auto const ir = stdex::mdspan{impulse.data_handle(), stdex::extents{1, impulse.extent(0)}};
+    auto filter   = stdex::mdarray<Complex, stdex::dextents<std::size_t, 2>>{
+        convolution::uniform_partition_extents(static_cast<std::size_t>(impulse.extent(0)), block_size),
+    };
+
+    auto const out = filter.to_mdspan();
+    convolution::uniform_partition(ir, block_size, [out](std::size_t /*ch*/, std::size_t p, auto spectrum) {
+        copy(spectrum, stdex::submdspan(out, p, stdex::full_extent));
+    });
+
+    return filter;
+}
+
+/// Noise impulse response of the given length, partitioned like partition_impulse.
+template<std::floating_point Float, typename URNG = std::mt19937>
+[[nodiscard]] auto generate_noise_filter(std::size_t length, std::size_t block_size, typename URNG::result_type seed)
+    -> stdex::mdarray<std::complex<Float>, stdex::dextents<std::size_t, 2>>
+{
+    auto const impulse = generate_noise_signal<Float, URNG>(length, seed);
+    return partition_impulse(impulse.to_mdspan(), block_size);
+}
+
+}  // namespace neo
@@ -4,5 +4,6 @@
 
 #include <neo/config.hpp>
 
+#include <neo/unit/bark.hpp>
 #include <neo/unit/decibel.hpp>
 #include <neo/unit/mel.hpp>
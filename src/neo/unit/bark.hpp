@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cmath>
+#include <concepts>
+
+namespace neo {
+
+/// Critical band rate after Traunmüller (1990).
+template<std::floating_point Float>
+[[nodiscard]] auto hertz_to_bark(Float hertz) noexcept -> Float
+{
+    return Float(26.81) * hertz / (Float(1960) + hertz) - Float(0.53);
+}
+
+template<std::floating_point Float>
+[[nodiscard]] auto bark_to_hertz(Float bark) noexcept -> Float
+{
+    return Float(1960) * (bark + Float(0.53)) / (Float(26.28) - bark);
+}
+
+/// Equivalent rectangular bandwidth rate after Glasberg & Moore (1990).
+template<std::floating_point Float>
+[[nodiscard]] auto hertz_to_erb(Float hertz) noexcept -> Float
+{
+    return Float(21.4) * std::log10(Float(1) + Float(0.00437) * hertz);
+}
+
+template<std::floating_point Float>
+[[nodiscard]] auto erb_to_hertz(Float erb) noexcept -> Float
+{
+    return (std::pow(Float(10), erb / Float(21.4)) - Float(1)) / Float(0.00437);
+}
+
+}  // namespace neo
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: MIT
+
+#include "bark.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+TEMPLATE_TEST_CASE("neo/unit: hertz_to_bark", "", float, double)
+{
+    using Float = TestType;
+
+    REQUIRE(neo::hertz_to_bark(Float(100)) == Catch::Approx(0.77).margin(0.05));
+    REQUIRE(neo::hertz_to_bark(Float(1000)) == Catch::Approx(8.53).margin(0.05));
+    REQUIRE(neo::hertz_to_bark(Float(4000)) == Catch::Approx(17.46).margin(0.05));
+
+    auto const hertz = GENERATE(as<Float>{}, 20, 55, 440, 1000, 8000, 20000);
+    REQUIRE_THAT(neo::bark_to_hertz(neo::hertz_to_bark(hertz)), Catch::Matchers::WithinRel(hertz, Float(1e-4)));
+}
+
+TEMPLATE_TEST_CASE("neo/unit: hertz_to_erb", "", float, double)
+{
+    using Float = TestType;
+
+    REQUIRE(neo::hertz_to_erb(Float(0)) == Catch::Approx(0.0).margin(1e-6));
+    REQUIRE(neo::hertz_to_erb(Float(1000)) == Catch::Approx(15.62).margin(0.05));
+
+    auto const hertz = GENERATE(as<Float>{}, 20, 55, 440, 1000, 8000, 20000);
+    REQUIRE_THAT(neo::erb_to_hertz(neo::hertz_to_erb(hertz)), Catch::Matchers::WithinRel(hertz, Float(1e-4)));
+}